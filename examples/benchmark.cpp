@@ -11,6 +11,10 @@ The benchmark runs for 10 seconds and then computes and prints statistics:
 average, median, min, max instantaneous jitter (ns and µs),
 average (absolute), median, min, max cumulative phase error (ns and µs),
 saves raw per-iteration data to timing_data.csv.
+Afterwards it compares the per-tick overhead of the minimal and the full-featured
+executor policy configurations, measures scheduler churn, reports the memory,
+file descriptors and mappings each executor costs, and measures an array of 64
+executors ticking while a monitor polls them.
 @note The code intentionally uses std::chrono::steady_clock for timing to measure intervals and
   avoid issues from system clock adjustments. The value of steady_clock::time_since_epoch()
   has an unspecified epoch and must not be interpreted as system wall-clock time.
@@ -22,6 +26,7 @@ saves raw per-iteration data to timing_data.csv.
 @date 2025-10-18
 */
 #include "PeriodicExecutor.hpp"
+#include "PeriodicScheduler.hpp"
 #include <iostream>
 #include <chrono>
 #include <atomic>
@@ -29,6 +34,246 @@ saves raw per-iteration data to timing_data.csv.
 #include <algorithm> // Required for std::min_element, std::max_element, std::sort
 #include <cmath>     // Required for std::abs
 #include <fstream>   // Required for file output
+#include <cstdint>
+#include <string>
+#if defined(__linux__)
+#include <dirent.h>
+#endif
+
+/**
+@brief Measures the per-tick overhead of one executor configuration.
+@details
+Runs the executor with a zero interval, so every deadline has already passed when the
+timer is armed and the handler runs back to back. The number of executions in one
+second therefore measures the cost of one tick: timer handling, strand dispatch and
+the executor's own bookkeeping. The callback only counts; it is read after stop(),
+which joins the worker.
+@tparam Policies The executor policy configuration.
+@param[in] configure Attaches optional features to the executor before start().
+@returns The average time per tick in nanoseconds.
+*/
+template <typename Policies, typename Configure>
+double measure_tick_overhead_ns(Configure configure) {
+    PeriodicExecutor<boost::asio::io_context::executor_type, Policies> executor;
+    configure(executor);
+    std::uint64_t ticks = 0;
+    const auto begin = std::chrono::steady_clock::now();
+    executor.start(std::chrono::milliseconds(0), [&ticks]() { ++ticks; });
+    boost::this_thread::sleep_for(boost::chrono::seconds(1));
+    executor.stop();
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    return ticks > 0 ? std::chrono::duration<double, std::nano>(elapsed).count() / ticks : 0.0;
+}
+
+/**
+@brief Prints the per-tick overhead of the minimal and the full-featured configuration.
+@details
+The minimal configuration (MinimalExecutorPolicies) stores the callback inline and
+compiles out stats and the per-execution hooks. The single-threaded configuration
+(SingleThreadedExecutorPolicies) additionally drops the strand and creates the
+io_context with BOOST_ASIO_CONCURRENCY_HINT_UNSAFE_IO. The full configuration
+(FullExecutorPolicies) maintains stats, serializes control with a std::mutex and has
+a watchdog attached.
+*/
+void compare_policies() {
+    const double minimal_ns = measure_tick_overhead_ns<MinimalExecutorPolicies>([](auto&) {});
+    const double single_ns = measure_tick_overhead_ns<SingleThreadedExecutorPolicies>([](auto&) {});
+    Watchdog watchdog([](const StallReport&) {});
+    watchdog.start();
+    const double full_ns = measure_tick_overhead_ns<FullExecutorPolicies>([&watchdog](auto& executor) {
+        executor.set_watchdog(watchdog, 1000, "benchmark");
+    });
+    watchdog.stop();
+
+    std::cout << "--- Per-Tick Overhead by Policy ---" << std::endl;
+    std::cout << "Single-threaded:  " << single_ns << " ns/tick" << std::endl;
+    std::cout << "Minimal policies: " << minimal_ns << " ns/tick" << std::endl;
+    std::cout << "Full policies:    " << full_ns << " ns/tick" << std::endl;
+    std::cout << "----------------------------------------" << std::endl;
+}
+
+/**
+@brief Measures the add/cancel throughput of one PeriodicScheduler under multi-threaded churn.
+@details
+Each caller thread repeatedly registers a periodic task and removes it again, and
+submits a one-shot job and cancels its handle, as connection keepalives do. Task
+nodes and the posted control operations come from TaskPool and handles from a
+lock-free slot table, so after the first round the churn runs on the per-thread
+caches. The captureless callbacks fit std::function's inline buffer; a larger
+callable would add one global heap allocation per add_task(). The clock stops once
+the worker has processed every posted operation.
+@param[in] threads The number of caller threads.
+@param[in] rounds The add/cancel pairs issued per thread.
+@returns The add/cancel pairs per second, across all threads.
+*/
+double measure_scheduler_churn(int threads, int rounds) {
+    PeriodicScheduler scheduler;
+    scheduler.start();
+    const auto begin = std::chrono::steady_clock::now();
+    boost::thread_group callers;
+    for (int t = 0; t < threads; ++t) {
+        callers.create_thread([&scheduler, rounds]() {
+            for (int i = 0; i < rounds; ++i) {
+                scheduler.remove_task(scheduler.add_task(std::chrono::hours(1), []() {}));
+                scheduler.cancel(scheduler.schedule_after(std::chrono::hours(1), []() {}));
+            }
+        });
+    }
+    callers.join_all();
+    std::atomic<bool> drained{false};
+    scheduler.post_at(PeriodicScheduler::clock_type::now(), [&drained]() { drained = true; });
+    while (!drained) {
+        boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - begin;
+    scheduler.stop();
+    return 2.0 * threads * rounds / std::chrono::duration<double>(elapsed).count();
+}
+
+/**
+@brief Prints the scheduler's add/cancel throughput for one to eight caller threads.
+*/
+void compare_scheduler_churn() {
+    std::cout << "--- Scheduler Add/Cancel Churn ---" << std::endl;
+    for (int threads : {1, 2, 4, 8}) {
+        const double pairs_per_second = measure_scheduler_churn(threads, 100000);
+        std::cout << threads << " thread(s): " << static_cast<long long>(pairs_per_second)
+                  << " add/cancel pairs/s" << std::endl;
+    }
+    std::cout << "----------------------------------------" << std::endl;
+}
+
+/**
+@brief A sample of the process's resource usage.
+@details
+Read from /proc on Linux; elsewhere every field stays zero.
+*/
+struct ProcessFootprint {
+    long rss_kib = 0;        /**< @brief Resident set size (VmRSS). */
+    long virtual_kib = 0;    /**< @brief Reserved address space (VmSize). */
+    long descriptors = 0;    /**< @brief Open file descriptors. */
+    long mappings = 0;       /**< @brief Virtual memory areas (lines of /proc/self/maps). */
+};
+
+/**
+@brief Samples the current ProcessFootprint.
+*/
+ProcessFootprint sample_footprint() {
+    ProcessFootprint footprint;
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0) {
+            footprint.rss_kib = std::stol(line.substr(6));
+        } else if (line.compare(0, 7, "VmSize:") == 0) {
+            footprint.virtual_kib = std::stol(line.substr(7));
+        }
+    }
+    if (DIR* directory = opendir("/proc/self/fd")) {
+        while (readdir(directory) != nullptr) {
+            ++footprint.descriptors;
+        }
+        closedir(directory);
+    }
+    std::ifstream maps("/proc/self/maps");
+    while (std::getline(maps, line)) {
+        ++footprint.mappings;
+    }
+#endif
+    return footprint;
+}
+
+/**
+@brief Prints the per-executor cost of a batch of idle and of running executors.
+@details
+Constructs `count` executors, then starts them all with a 1 s interval, once with the
+platform's default worker stack and once with a 64 KiB stack. An idle executor owns
+no io_context, timer or thread; a running one adds the context's epoll, eventfd and
+timerfd descriptors, the worker's stack mapping and its guard page.
+@param[in] count The number of executors in the batch.
+*/
+void report_executor_footprint(int count) {
+    std::cout << "--- Per-Executor Footprint (" << count << " executors) ---" << std::endl;
+    std::cout << "sizeof(PeriodicExecutor<>): " << sizeof(PeriodicExecutor<>) << " bytes" << std::endl;
+    for (std::size_t stack_size : {std::size_t(0), std::size_t(64 * 1024)}) {
+        const ProcessFootprint base = sample_footprint();
+        std::vector<PeriodicExecutor<>> executors(count);
+        for (auto& executor : executors) {
+            executor.set_stack_size(stack_size);
+        }
+        const ProcessFootprint idle = sample_footprint();
+        for (auto& executor : executors) {
+            executor.start(std::chrono::milliseconds(1000), []() {});
+        }
+        const ProcessFootprint running = sample_footprint();
+        for (auto& executor : executors) {
+            executor.stop();
+        }
+        const auto per = [count](long after, long before) { return static_cast<double>(after - before) / count; };
+        std::cout << (stack_size == 0 ? "Default stack: " : "64 KiB stack:  ")
+                  << "idle " << per(idle.rss_kib, base.rss_kib) << " KiB RSS, "
+                  << per(idle.descriptors, base.descriptors) << " fds; running "
+                  << per(running.rss_kib, base.rss_kib) << " KiB RSS, "
+                  << per(running.virtual_kib, base.virtual_kib) << " KiB virtual, "
+                  << per(running.descriptors, base.descriptors) << " fds, "
+                  << per(running.mappings, base.mappings) << " VMAs" << std::endl;
+    }
+    std::cout << "----------------------------------------" << std::endl;
+}
+
+/**
+@brief Prints the tick and monitoring throughput of a contiguous array of executors.
+@details
+Reproduces the access pattern `perf c2c` flags as false sharing: `count` executors
+sit side by side in one std::vector, every worker ticks with a zero interval and so
+writes its executor's worker block continuously, while a monitor thread polls
+stats() of all of them. Each executor is cache-line aligned and keeps its
+worker-written, control-written and read-mostly members in separate lines, so a
+worker's writes only invalidate lines the monitor actually reads. Run the benchmark
+under `perf c2c record` to see the remaining HITM (modified-line) transfers per line.
+@param[in] count The number of executors in the array.
+*/
+void report_executor_sharing(int count) {
+    std::vector<PeriodicExecutor<>> executors(count);
+    bool shared_line = false;
+    for (std::size_t i = 0; i + 1 < executors.size(); ++i) {
+        const auto end = reinterpret_cast<std::uintptr_t>(&executors[i]) + sizeof(executors[i]) - 1;
+        shared_line = shared_line || end / 64 == reinterpret_cast<std::uintptr_t>(&executors[i + 1]) / 64;
+    }
+    std::atomic<bool> monitoring{true};
+    std::uint64_t polls = 0;
+    for (auto& executor : executors) {
+        executor.start(std::chrono::milliseconds(0), []() {});
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    boost::thread monitor([&executors, &monitoring, &polls]() {
+        while (monitoring.load(std::memory_order_relaxed)) {
+            for (const auto& executor : executors) {
+                polls += executor.stats().tick_count > 0 ? 1 : 0;
+            }
+        }
+    });
+    boost::this_thread::sleep_for(boost::chrono::seconds(1));
+    monitoring = false;
+    monitor.join();
+    std::uint64_t ticks = 0;
+    for (const auto& executor : executors) {
+        ticks += executor.stats().tick_count;
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    for (auto& executor : executors) {
+        executor.stop();
+    }
+
+    std::cout << "--- Executor Array Sharing (" << count << " executors) ---" << std::endl;
+    std::cout << "sizeof/alignof: " << sizeof(PeriodicExecutor<>) << "/" << alignof(PeriodicExecutor<>)
+              << " bytes, neighbours share a line: " << (shared_line ? "yes" : "no") << std::endl;
+    std::cout << "Ticks:        " << static_cast<long long>(ticks / seconds) << " /s" << std::endl;
+    std::cout << "Stats polls:  " << static_cast<long long>(polls / seconds) << " /s" << std::endl;
+    std::cout << "----------------------------------------" << std::endl;
+}
+
 /**
 @brief Entry point for the benchmark.
 @details
@@ -253,5 +498,10 @@ computes instantaneous and cumulative errors and stores them.
     } catch (const std::exception& e) {
         std::cerr << "Unexpected error while writing CSV: " << e.what() << '\n';
     }
+
+    compare_policies();
+    compare_scheduler_churn();
+    report_executor_footprint(64);
+    report_executor_sharing(64);
     return 0;
 }
@@ -0,0 +1,105 @@
+#include "TimingRing.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @file timing_ring_tail.cpp
+ * @brief Follows a timing ring file and prints latency percentiles.
+ *
+ * @details Usage: `\`timing_ring_tail <ring file> [report interval ms] [reports]\``.
+ *
+ * The tool maps the ring read-only, so it never slows down the executor that writes it.
+ * Every report interval it collects the records written since the last report and
+ * prints the count, the number of late and overrunning executions, the records lost
+ * because the tool fell behind, and the 50th/90th/99th percentiles and maximum of the
+ * wake-up latency (wake-up minus deadline) and of the callback duration, in
+ * microseconds. Without a report count it runs until interrupted.
+ */
+
+/**
+ * @brief Returns the `\`q\``-quantile of sorted values, by the nearest-rank method.
+ *
+ * @param [in] sorted The values in ascending order; must not be empty.
+ * @param [in] q The quantile in `\`[0, 1]\``.
+ * @return The value in microseconds.
+ */
+double percentile_us(const std::vector<std::int64_t>& sorted, double q) {
+    const std::size_t rank = static_cast<std::size_t>(q * static_cast<double>(sorted.size() - 1) + 0.5);
+    return static_cast<double>(sorted[rank]) / 1000.0;
+}
+
+/**
+ * @brief Prints one line of percentiles.
+ *
+ * @param [in] label The name of the measured quantity.
+ * @param [in,out] values The values in nanoseconds; sorted in place.
+ * @par Returns
+ * Nothing.
+ */
+void print_percentiles(const char* label, std::vector<std::int64_t>& values) {
+    std::sort(values.begin(), values.end());
+    std::cout << "  " << label << " us: p50 " << percentile_us(values, 0.50) << "  p90 "
+              << percentile_us(values, 0.90) << "  p99 " << percentile_us(values, 0.99) << "  max "
+              << static_cast<double>(values.back()) / 1000.0 << std::endl;
+}
+
+/**
+ * @brief Entry point of the tool.
+ *
+ * @details Starts at the current end of the ring, so only records written after the
+ * tool started are reported.
+ * @return `0` on success, `1` on a usage or file error.
+ */
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <ring file> [report interval ms] [reports]" << std::endl;
+        return 1;
+    }
+    const std::chrono::milliseconds interval(argc > 2 ? std::atol(argv[2]) : 1000);
+    const long reports = argc > 3 ? std::atol(argv[3]) : 0;
+
+    try {
+        TimingRingFile file(argv[1]);
+        TimingRing& ring = file.ring();
+        std::cout << "Following " << argv[1] << " (" << ring.capacity() << " slots)" << std::endl;
+
+        std::uint64_t next = ring.written();
+        std::vector<TimingRecord> records;
+        std::vector<std::int64_t> latency;
+        std::vector<std::int64_t> duration;
+        for (long report = 0; reports == 0 || report < reports; ++report) {
+            std::this_thread::sleep_for(interval);
+            records.clear();
+            const std::uint64_t lost = ring.read(next, records);
+
+            std::cout << records.size() << " records, " << lost << " lost";
+            if (records.empty()) {
+                std::cout << std::endl;
+                continue;
+            }
+            latency.clear();
+            duration.clear();
+            std::size_t late = 0;
+            std::size_t overruns = 0;
+            for (const TimingRecord& record : records) {
+                latency.push_back(record.wake_ns - record.deadline_ns);
+                duration.push_back(record.duration_ns);
+                late += (record.flags & TimingRecord::Late) != 0;
+                overruns += (record.flags & TimingRecord::Overrun) != 0;
+            }
+            std::cout << ", " << late << " late, " << overruns << " overruns" << std::endl;
+            print_percentiles("wake latency", latency);
+            print_percentiles("duration    ", duration);
+        }
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
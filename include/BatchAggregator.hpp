@@ -0,0 +1,401 @@
+#ifndef BATCH_AGGREGATOR_HPP
+#define BATCH_AGGREGATOR_HPP
+#include "PeriodicExecutor.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @file
+ * @brief Header file for the BatchAggregator class.
+ */
+
+/**
+ * @class BatchAggregator
+ * @brief Collects items from many producer threads and hands them to a sink in batches.
+ *
+ * @details Each producer thread appends to its own buffer, guarded by a mutex that only
+ * the flush ever contends for, so producers do not serialize on each other. A batch is
+ * handed to the sink either when a producer's buffer reaches `\`max_batch\`` items, in
+ * which case that producer delivers it right away, or on the periodic tick, which
+ * collects whatever all buffers hold. Per-item syscalls or lock acquisitions in the
+ * sink thus become one per batch, and because the tick uses `\`PeriodicExecutor\``'s
+ * anti-drift timing, no item waits much longer than one interval.
+ *
+ * Sink calls are serialized, so the sink needs no synchronization of its own. Items
+ * from one producer keep their order within a batch; batches from the size trigger
+ * and from the tick may overtake each other.
+ *
+ * @tparam T The item type.
+ */
+template <typename T>
+class BatchAggregator {
+public:
+    /**
+     * @brief Receives one batch; the aggregator clears it after the call.
+     */
+    using Sink = std::function<void(std::vector<T>&)>;
+
+    /**
+     * @brief Constructs a stopped aggregator.
+     * @param[in] sink Receives the batches; calls are serialized.
+     * @param[in] max_batch The largest batch handed to the sink and the per-thread
+     * buffer size that triggers an early flush.
+     */
+    BatchAggregator(Sink sink, std::size_t max_batch);
+
+    /**
+     * @brief Destructor for `BatchAggregator`.
+     * @details Calls `\`stop()\``, which delivers the remaining items.
+     */
+    ~BatchAggregator();
+
+    /**
+     * @brief Starts the periodic flush.
+     * @param[in] interval The longest time an item waits in a buffer, up to scheduling delays.
+     * @return `true` if started, `false` if already running.
+     */
+    bool start(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Stops the periodic flush and delivers all buffered items.
+     * @details Producers must have stopped appending. Can be called multiple times.
+     */
+    void stop();
+
+    /**
+     * @brief Appends an item to the calling thread's buffer.
+     * @details Safe to call from any thread. Delivers the buffer if it is full.
+     * @param[in] item The item to append.
+     */
+    void append(T item);
+
+    /**
+     * @brief Collects all buffers and delivers their items now.
+     */
+    void flush();
+
+    /**
+     * @brief Returns the number of batches delivered so far.
+     */
+    std::uint64_t batches() const;
+
+    /**
+     * @brief Returns the number of items delivered so far.
+     */
+    std::uint64_t items() const;
+
+    /**
+     * @brief Returns the number of aggregators the calling thread keeps a buffer lookup for.
+     * @details Lookups of destroyed aggregators are dropped on the thread's next lookup miss.
+     */
+    static std::size_t cached_buffers();
+
+    // Producer threads cache pointers into the aggregator.
+    BatchAggregator(const BatchAggregator&) = delete;
+    BatchAggregator& operator=(const BatchAggregator&) = delete;
+
+private:
+    /**
+     * @brief One producer thread's pending items.
+     */
+    struct ThreadBuffer {
+        std::mutex mutex;
+        /**< @brief Taken by the owning producer and, once per flush, by the collector. */
+        std::vector<T> items;
+        /**< @brief The items appended since the last flush. */
+    };
+
+    /**
+     * @brief One thread's lookup from aggregator identifiers to its buffers.
+     */
+    struct ThreadCache {
+        std::uint64_t cached_id = 0;
+        /**< @brief The aggregator the thread appended to last. */
+        ThreadBuffer* cached_buffer = nullptr;
+        /**< @brief That aggregator's buffer for this thread. */
+        std::uint64_t seen_retired = 0;
+        /**< @brief The value of `\`retired()\`` when the map was last pruned. */
+        std::unordered_map<std::uint64_t, std::weak_ptr<ThreadBuffer>> buffers;
+        /**< @brief The other aggregators' buffers; expired once the aggregator is destroyed. */
+    };
+
+    /**
+     * @brief Returns the calling thread's buffer, registering it on first use.
+     */
+    ThreadBuffer& local_buffer();
+
+    /**
+     * @brief Returns the calling thread's cache.
+     */
+    static ThreadCache& thread_cache();
+
+    /**
+     * @brief Returns the count of destroyed aggregators, which tells threads when to prune.
+     */
+    static std::atomic<std::uint64_t>& retired();
+
+    /**
+     * @brief Hands a batch to the sink under `\`sink_mutex_\`` and clears it.
+     * @param[in,out] batch The batch to deliver.
+     */
+    void deliver(std::vector<T>& batch);
+
+    /**
+     * @brief Returns a process-unique identifier for a new aggregator.
+     */
+    static std::uint64_t next_id();
+
+    Sink sink_;
+    /**< @brief The user-supplied sink. */
+    std::size_t max_batch_;
+    /**< @brief The batch size limit and early-flush threshold. */
+    std::uint64_t id_;
+    /**< @brief Keys the thread-local buffer lookup; unlike the address, never reused. */
+    std::mutex registry_mutex_;
+    /**< @brief Protects `\`buffers_\``. */
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    /**< @brief One buffer per producer thread that has appended. */
+    std::mutex sink_mutex_;
+    /**< @brief Serializes sink calls. */
+    std::vector<T> collected_;
+    /**< @brief Collector only: items gathered from all buffers in one flush. */
+    std::mutex collect_mutex_;
+    /**< @brief Serializes flushes from the tick, `\`flush()\`` and `\`stop()\``. */
+    std::atomic<std::uint64_t> batches_{0};
+    /**< @brief Batches delivered. */
+    std::atomic<std::uint64_t> items_{0};
+    /**< @brief Items delivered. */
+    PeriodicExecutor<> executor_;
+    /**< @brief Drives the periodic flush; declared last so it stops before the buffers go away. */
+};
+
+// BatchAggregator Implementation
+
+/**
+ * @fn BatchAggregator::BatchAggregator(Sink sink, std::size_t max_batch)
+ * @brief Constructs a stopped aggregator.
+ */
+template <typename T>
+BatchAggregator<T>::BatchAggregator(Sink sink, std::size_t max_batch)
+    : sink_(std::move(sink)), max_batch_(max_batch == 0 ? 1 : max_batch), id_(next_id()) {}
+
+/**
+ * @fn BatchAggregator::~BatchAggregator()
+ * @brief Stops the tick, delivers the remaining items and retires the buffers.
+ *
+ * @details The buffers are released before `\`retired()\`` is bumped, so a thread that
+ * sees the new count also sees their lookups expired.
+ */
+template <typename T>
+BatchAggregator<T>::~BatchAggregator() {
+    stop();
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        buffers_.clear();
+    }
+    retired().fetch_add(1, std::memory_order_release);
+}
+
+/**
+ * @fn BatchAggregator::start(std::chrono::milliseconds interval)
+ * @brief Starts the executor with `\`flush()\`` as its callback.
+ */
+template <typename T>
+bool BatchAggregator<T>::start(std::chrono::milliseconds interval) {
+    return executor_.start(interval, [this]() { flush(); });
+}
+
+/**
+ * @fn BatchAggregator::stop()
+ * @brief Stops the executor, then flushes on the calling thread.
+ */
+template <typename T>
+void BatchAggregator<T>::stop() {
+    executor_.stop();
+    flush();
+}
+
+/**
+ * @fn BatchAggregator::append(T item)
+ * @brief Appends to the calling thread's buffer.
+ *
+ * @details A full buffer is swapped out under its mutex and delivered after the mutex
+ * is released, so the collector is never blocked behind a sink call.
+ * @param[in] item The item to append.
+ */
+template <typename T>
+void BatchAggregator<T>::append(T item) {
+    ThreadBuffer& buffer = local_buffer();
+    std::vector<T> batch;
+    {
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        if (buffer.items.capacity() < max_batch_) {
+            buffer.items.reserve(max_batch_);
+        }
+        buffer.items.push_back(std::move(item));
+        if (buffer.items.size() < max_batch_) {
+            return;
+        }
+        batch.swap(buffer.items);
+    }
+    deliver(batch);
+}
+
+/**
+ * @fn BatchAggregator::flush()
+ * @brief Gathers all buffers into one collection and delivers it in `\`max_batch\`` chunks.
+ *
+ * @details Each buffer's mutex is held only for a swap with an empty vector that
+ * already has the reserved capacity, so producers are blocked for a few instructions.
+ */
+template <typename T>
+void BatchAggregator<T>::flush() {
+    std::lock_guard<std::mutex> collect_lock(collect_mutex_);
+    std::vector<T> swapped;
+    {
+        std::lock_guard<std::mutex> registry_lock(registry_mutex_);
+        for (auto& buffer : buffers_) {
+            swapped.reserve(max_batch_);
+            {
+                std::lock_guard<std::mutex> lock(buffer->mutex);
+                if (buffer->items.empty()) {
+                    continue;
+                }
+                swapped.swap(buffer->items);
+            }
+            for (T& item : swapped) {
+                collected_.push_back(std::move(item));
+            }
+            swapped.clear();
+        }
+    }
+
+    std::vector<T> batch;
+    for (std::size_t begin = 0; begin < collected_.size(); begin += max_batch_) {
+        const std::size_t end = std::min(collected_.size(), begin + max_batch_);
+        batch.assign(std::make_move_iterator(collected_.begin() + begin),
+                     std::make_move_iterator(collected_.begin() + end));
+        deliver(batch);
+    }
+    collected_.clear();
+}
+
+/**
+ * @fn BatchAggregator::deliver(std::vector<T>& batch)
+ * @brief Calls the sink with one batch and updates the counters.
+ */
+template <typename T>
+void BatchAggregator<T>::deliver(std::vector<T>& batch) {
+    const std::size_t count = batch.size();
+    {
+        std::lock_guard<std::mutex> lock(sink_mutex_);
+        sink_(batch);
+    }
+    batch.clear();
+    batches_.fetch_add(1, std::memory_order_relaxed);
+    items_.fetch_add(count, std::memory_order_relaxed);
+}
+
+/**
+ * @fn BatchAggregator::local_buffer()
+ * @brief Finds the calling thread's buffer.
+ *
+ * @details The last aggregator a thread appended to is cached, so the common case is
+ * one comparison. Other aggregators are found in a thread-local map keyed by the
+ * aggregator's unique identifier. On a miss, if any aggregator has been destroyed
+ * since the last look, the expired entries are erased first, so the map holds only
+ * live aggregators this thread has appended to.
+ */
+template <typename T>
+typename BatchAggregator<T>::ThreadBuffer& BatchAggregator<T>::local_buffer() {
+    ThreadCache& cache = thread_cache();
+    if (cache.cached_id == id_) {
+        return *cache.cached_buffer;
+    }
+    const std::uint64_t retired_now = retired().load(std::memory_order_acquire);
+    if (retired_now != cache.seen_retired) {
+        cache.seen_retired = retired_now;
+        for (auto it = cache.buffers.begin(); it != cache.buffers.end();) {
+            it = it->second.expired() ? cache.buffers.erase(it) : std::next(it);
+        }
+    }
+    std::shared_ptr<ThreadBuffer> buffer = cache.buffers[id_].lock();
+    if (!buffer) {
+        buffer = std::make_shared<ThreadBuffer>();
+        cache.buffers[id_] = buffer;
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        buffers_.push_back(buffer);
+    }
+    cache.cached_id = id_;
+    cache.cached_buffer = buffer.get();
+    return *buffer;
+}
+
+/**
+ * @fn BatchAggregator::thread_cache()
+ * @brief Holds the calling thread's cache in a function-local `\`thread_local\``.
+ */
+template <typename T>
+typename BatchAggregator<T>::ThreadCache& BatchAggregator<T>::thread_cache() {
+    thread_local ThreadCache cache;
+    return cache;
+}
+
+/**
+ * @fn BatchAggregator::retired()
+ * @brief Holds the destruction count shared by all aggregators of this item type.
+ */
+template <typename T>
+std::atomic<std::uint64_t>& BatchAggregator<T>::retired() {
+    static std::atomic<std::uint64_t> count{0};
+    return count;
+}
+
+/**
+ * @fn BatchAggregator::cached_buffers()
+ * @brief Reads the size of the calling thread's lookup map.
+ */
+template <typename T>
+std::size_t BatchAggregator<T>::cached_buffers() {
+    return thread_cache().buffers.size();
+}
+
+/**
+ * @fn BatchAggregator::next_id()
+ * @brief Hands out aggregator identifiers, starting at 1.
+ */
+template <typename T>
+std::uint64_t BatchAggregator<T>::next_id() {
+    static std::atomic<std::uint64_t> counter{0};
+    return ++counter;
+}
+
+/**
+ * @fn BatchAggregator::batches() const
+ * @brief Reads the batch counter.
+ */
+template <typename T>
+std::uint64_t BatchAggregator<T>::batches() const {
+    return batches_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @fn BatchAggregator::items() const
+ * @brief Reads the item counter.
+ */
+template <typename T>
+std::uint64_t BatchAggregator<T>::items() const {
+    return items_.load(std::memory_order_relaxed);
+}
+
+#endif // BATCH_AGGREGATOR_HPP
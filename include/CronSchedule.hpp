@@ -0,0 +1,430 @@
+#ifndef CRON_SCHEDULE_HPP
+#define CRON_SCHEDULE_HPP
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @file
+ * @brief Header file for the CronSchedule class.
+ */
+
+/**
+ * @class CronSchedule
+ * @brief A cron-like calendar schedule with constant-time next-fire lookup.
+ *
+ * @details The schedule is parsed from a six-field expression
+ * `\`second minute hour day-of-month month day-of-week\``, for example
+ * `\`"0/15 * 8-17 * * *"\`` (every 15 seconds between 08:00 and 17:59) or
+ * `\`"0 * * * * *"\`` (the first second of each minute). Each field accepts `\`*\``,
+ * single values, ranges `\`a-b\``, steps `\`a/n\`` or `\`a-b/n\`` (a bare `\`*\`` may also
+ * take a step) and comma-separated lists.
+ * Day-of-week runs from 0 (Sunday) to 6. As in classic cron, when both day fields are
+ * restricted a day matches if either of them does.
+ *
+ * Every field is stored as a bitset together with a precomputed table that maps each
+ * value to the next allowed value, and the day-of-week field is expanded once into a
+ * day-of-month mask for each possible weekday of the 1st. `\`next()\`` therefore needs
+ * no iterative search: each field is resolved with one table lookup and at most one
+ * carry into the next larger field. Calendar arithmetic uses a fixed UTC offset, so
+ * daylight-saving transitions are not applied automatically.
+ */
+class CronSchedule {
+public:
+    /**
+     * @brief The wall clock in which cron fields are interpreted.
+     */
+    using clock_type = std::chrono::system_clock;
+
+    /**
+     * @brief Parses a six-field cron expression.
+     * @param[in] expression The expression, e.g. `\`"0 30 9 * * 1-5"\``.
+     * @param[in] utc_offset The offset of the schedule's local time from UTC.
+     * @throws std::invalid_argument If the expression is malformed or out of range.
+     */
+    explicit CronSchedule(const std::string& expression,
+                          std::chrono::minutes utc_offset = std::chrono::minutes::zero());
+
+    /**
+     * @brief Computes the first fire time strictly after `\`after\``.
+     *
+     * @details Runs in constant time. Schedules that can never fire (such as
+     * the 30th of February) return `\`clock_type::time_point::max()\``.
+     *
+     * @param[in] after The reference point, usually the previous fire time or now.
+     * @return The next fire time at whole-second resolution.
+     */
+    clock_type::time_point next(clock_type::time_point after) const;
+
+private:
+    /**
+     * @brief One cron field: its allowed values and the next-allowed-value table.
+     */
+    struct Field {
+        std::uint64_t bits = 0;
+        /**< @brief Bit `\`v\`` is set if value `\`v\`` is allowed. */
+        std::array<std::uint8_t, 64> next{};
+        /**< @brief Smallest allowed value `\`>= v\``, or `\`none\`` if there is none. */
+        bool any = false;
+        /**< @brief `true` if the field was given as a bare `\`*\``. */
+    };
+
+    /**
+     * @brief Marker in `\`Field::next\`` for "no allowed value left".
+     */
+    static constexpr std::uint8_t none = 0xFF;
+
+    /**
+     * @brief Parses one field and precomputes its next-value table.
+     * @param[in] text The field text.
+     * @param[in] min The smallest legal value.
+     * @param[in] max The largest legal value.
+     * @return The parsed field.
+     */
+    static Field parse_field(const std::string& text, int min, int max);
+
+    /**
+     * @brief Converts a civil date to days since 1970-01-01.
+     * @param[in] y The year.
+     * @param[in] m The month, 1 to 12.
+     * @param[in] d The day of the month, 1 to 31.
+     * @return The day number.
+     */
+    static std::int64_t days_from_civil(std::int64_t y, unsigned m, unsigned d);
+
+    /**
+     * @brief Converts days since 1970-01-01 to a civil date.
+     * @param[in] z The day number.
+     * @param[out] y The year.
+     * @param[out] m The month, 1 to 12.
+     * @param[out] d The day of the month, 1 to 31.
+     */
+    static void civil_from_days(std::int64_t z, std::int64_t& y, unsigned& m, unsigned& d);
+
+    /**
+     * @brief Returns the index of the lowest set bit.
+     * @param[in] mask A non-zero mask.
+     * @return The number of trailing zero bits.
+     */
+    static unsigned lowest_bit(std::uint32_t mask);
+
+    /**
+     * @brief Returns the allowed days of a month as a bitmask (bit `\`d\`` for day `\`d\``).
+     * @param[in] y The year.
+     * @param[in] m The month, 1 to 12.
+     * @return The mask of days matching the day-of-month and day-of-week fields.
+     */
+    std::uint32_t day_mask(std::int64_t y, unsigned m) const;
+
+    Field second_;
+    /**< @brief Allowed seconds, 0 to 59. */
+    Field minute_;
+    /**< @brief Allowed minutes, 0 to 59. */
+    Field hour_;
+    /**< @brief Allowed hours, 0 to 23. */
+    Field day_of_month_;
+    /**< @brief Allowed days of the month, 1 to 31. */
+    Field month_;
+    /**< @brief Allowed months, 1 to 12. */
+    std::array<std::uint32_t, 7> weekday_days_{};
+    /**< @brief For each weekday of the 1st, the days of the month allowed by the day-of-week field. */
+    bool day_of_week_any_ = true;
+    /**< @brief `true` if the day-of-week field was a bare `\`*\``. */
+    std::int64_t offset_seconds_ = 0;
+    /**< @brief The schedule's UTC offset in seconds. */
+};
+
+// CronSchedule Implementation
+
+/**
+ * @fn CronSchedule::CronSchedule(const std::string& expression, std::chrono::minutes utc_offset)
+ * @brief Parses a six-field cron expression.
+ *
+ * @details Splits the expression at whitespace, parses each field and expands the
+ * day-of-week field into one day-of-month mask per weekday of the 1st.
+ * @param[in] expression The cron expression.
+ * @param[in] utc_offset The offset of the schedule's local time from UTC.
+ */
+inline CronSchedule::CronSchedule(const std::string& expression, std::chrono::minutes utc_offset)
+    : offset_seconds_(std::chrono::duration_cast<std::chrono::seconds>(utc_offset).count()) {
+    std::vector<std::string> fields;
+    std::string current;
+    for (char c : expression) {
+        if (c == ' ' || c == '\t') {
+            if (!current.empty()) {
+                fields.push_back(current);
+                current.clear();
+            }
+        } else {
+            current += c;
+        }
+    }
+    if (!current.empty()) {
+        fields.push_back(current);
+    }
+    if (fields.size() != 6) {
+        throw std::invalid_argument("cron expression needs 6 fields: " + expression);
+    }
+
+    second_ = parse_field(fields[0], 0, 59);
+    minute_ = parse_field(fields[1], 0, 59);
+    hour_ = parse_field(fields[2], 0, 23);
+    day_of_month_ = parse_field(fields[3], 1, 31);
+    month_ = parse_field(fields[4], 1, 12);
+    const Field day_of_week = parse_field(fields[5], 0, 6);
+    day_of_week_any_ = day_of_week.any;
+
+    for (unsigned first = 0; first < 7; ++first) {
+        std::uint32_t mask = 0;
+        for (unsigned d = 1; d <= 31; ++d) {
+            if (day_of_week.bits & (std::uint64_t{1} << ((first + d - 1) % 7))) {
+                mask |= std::uint32_t{1} << d;
+            }
+        }
+        weekday_days_[first] = mask;
+    }
+}
+
+/**
+ * @fn CronSchedule::parse_field(const std::string& text, int min, int max)
+ * @brief Parses one field.
+ *
+ * @details Each comma-separated item is `\`*\``, `\`v\`` or `\`a-b\``, optionally followed
+ * by `\`/step\``. After all bits are set, the next-value table is filled from the top
+ * down so that `\`next[v]\`` holds the smallest allowed value `\`>= v\``.
+ * @param[in] text The field text.
+ * @param[in] min The smallest legal value.
+ * @param[in] max The largest legal value.
+ * @return The parsed field.
+ */
+inline CronSchedule::Field CronSchedule::parse_field(const std::string& text, int min, int max) {
+    const auto number = [&](const std::string& s) {
+        std::size_t used = 0;
+        int value = -1;
+        try {
+            value = std::stoi(s, &used);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used != s.size() || s.empty() || value < min || value > max) {
+            throw std::invalid_argument("invalid cron field: " + text);
+        }
+        return value;
+    };
+
+    Field field;
+    field.any = text == "*";
+    std::size_t begin = 0;
+    while (begin <= text.size()) {
+        const std::size_t end = std::min(text.find(',', begin), text.size());
+        std::string item = text.substr(begin, end - begin);
+        begin = end + 1;
+
+        int step = 1;
+        const std::size_t slash = item.find('/');
+        if (slash != std::string::npos) {
+            std::size_t used = 0;
+            const std::string step_text = item.substr(slash + 1);
+            try {
+                step = std::stoi(step_text, &used);
+            } catch (const std::exception&) {
+                used = 0;
+            }
+            if (step_text.empty() || used != step_text.size() || step <= 0) {
+                throw std::invalid_argument("invalid cron step: " + text);
+            }
+            item = item.substr(0, slash);
+        }
+
+        int low = min;
+        int high = max;
+        if (item != "*") {
+            const std::size_t dash = item.find('-');
+            if (dash == std::string::npos) {
+                low = number(item);
+                high = slash == std::string::npos ? low : max;
+            } else {
+                low = number(item.substr(0, dash));
+                high = number(item.substr(dash + 1));
+            }
+        }
+        if (low > high) {
+            throw std::invalid_argument("invalid cron range: " + text);
+        }
+        for (int v = low; v <= high; v += step) {
+            field.bits |= std::uint64_t{1} << v;
+        }
+    }
+
+    std::uint8_t next_value = none;
+    for (int v = 63; v >= 0; --v) {
+        if (field.bits & (std::uint64_t{1} << v)) {
+            next_value = static_cast<std::uint8_t>(v);
+        }
+        field.next[v] = next_value;
+    }
+    return field;
+}
+
+/**
+ * @fn CronSchedule::days_from_civil(std::int64_t y, unsigned m, unsigned d)
+ * @brief Converts a proleptic Gregorian date to days since the Unix epoch.
+ *
+ * @details Uses the era-based algorithm by Howard Hinnant, which needs no tables and
+ * no loops.
+ * @return The day number.
+ */
+inline std::int64_t CronSchedule::days_from_civil(std::int64_t y, unsigned m, unsigned d) {
+    y -= m <= 2;
+    const std::int64_t era = (y >= 0 ? y : y - 399) / 400;
+    const unsigned yoe = static_cast<unsigned>(y - era * 400);
+    const unsigned doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<std::int64_t>(doe) - 719468;
+}
+
+/**
+ * @fn CronSchedule::civil_from_days(std::int64_t z, std::int64_t& y, unsigned& m, unsigned& d)
+ * @brief Converts days since the Unix epoch to a proleptic Gregorian date.
+ * @details The inverse of `\`days_from_civil()\``.
+ */
+inline void CronSchedule::civil_from_days(std::int64_t z, std::int64_t& y, unsigned& m, unsigned& d) {
+    z += 719468;
+    const std::int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(z - era * 146097);
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const unsigned mp = (5 * doy + 2) / 153;
+    d = doy - (153 * mp + 2) / 5 + 1;
+    m = mp < 10 ? mp + 3 : mp - 9;
+    y = static_cast<std::int64_t>(yoe) + era * 400 + (m <= 2);
+}
+
+/**
+ * @fn CronSchedule::lowest_bit(std::uint32_t mask)
+ * @brief Returns the index of the lowest set bit using the compiler intrinsic.
+ */
+inline unsigned CronSchedule::lowest_bit(std::uint32_t mask) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+}
+
+/**
+ * @fn CronSchedule::day_mask(std::int64_t y, unsigned m) const
+ * @brief Returns the allowed days of a month.
+ *
+ * @details Combines the day-of-month bits with the precomputed day-of-week mask for
+ * the weekday of the 1st, then clears the days the month does not have.
+ * @param[in] y The year.
+ * @param[in] m The month, 1 to 12.
+ * @return The mask of allowed days.
+ */
+inline std::uint32_t CronSchedule::day_mask(std::int64_t y, unsigned m) const {
+    const std::int64_t first_day = days_from_civil(y, m, 1);
+    const unsigned weekday = static_cast<unsigned>(((first_day % 7) + 11) % 7); // 1970-01-01 was a Thursday
+    const std::int64_t next_first = m == 12 ? days_from_civil(y + 1, 1, 1) : days_from_civil(y, m + 1, 1);
+    const unsigned length = static_cast<unsigned>(next_first - first_day);
+    const std::uint32_t in_month = static_cast<std::uint32_t>((std::uint64_t{1} << (length + 1)) - 2);
+
+    const std::uint32_t dom = static_cast<std::uint32_t>(day_of_month_.bits);
+    const std::uint32_t dow = weekday_days_[weekday];
+    std::uint32_t mask;
+    if (day_of_month_.any || day_of_week_any_) {
+        mask = dom & dow;
+    } else {
+        mask = dom | dow;
+    }
+    return mask & in_month;
+}
+
+/**
+ * @fn CronSchedule::next(clock_type::time_point after) const
+ * @brief Computes the next fire time.
+ *
+ * @details Starts one second after `\`after\`` in schedule-local time and resolves the
+ * fields from month down to second. A field with no allowed value left in its unit
+ * carries into the next larger unit and restarts from there. Each carry moves the
+ * candidate forward by at least one unit, and the month search gives up after four
+ * years, which bounds the work by a constant.
+ * @param[in] after The reference point.
+ * @return The next fire time, or `\`time_point::max()\`` if the schedule never fires.
+ */
+inline CronSchedule::clock_type::time_point CronSchedule::next(clock_type::time_point after) const {
+    using std::chrono::seconds;
+    constexpr std::int64_t day = 86400;
+
+    std::int64_t t = std::chrono::floor<seconds>(after.time_since_epoch()).count() + offset_seconds_ + 1;
+    const std::int64_t limit = t + 4 * 366 * day;
+
+    while (t < limit) {
+        const std::int64_t days = t >= 0 ? t / day : (t - day + 1) / day;
+        const std::int64_t second_of_day = t - days * day;
+        std::int64_t y;
+        unsigned m;
+        unsigned d;
+        civil_from_days(days, y, m, d);
+
+        const std::uint8_t next_month = month_.next[m];
+        if (next_month == none) {
+            t = days_from_civil(y + 1, month_.next[1], 1) * day;
+            continue;
+        }
+        if (next_month != m) {
+            t = days_from_civil(y, next_month, 1) * day;
+            continue;
+        }
+
+        const std::uint32_t days_left = day_mask(y, m) >> d;
+        if (days_left == 0) {
+            t = (m == 12 ? days_from_civil(y + 1, 1, 1) : days_from_civil(y, m + 1, 1)) * day;
+            continue;
+        }
+        if ((days_left & 1) == 0) {
+            t = (days + lowest_bit(days_left)) * day;
+            continue;
+        }
+
+        const unsigned h = static_cast<unsigned>(second_of_day / 3600);
+        const unsigned mi = static_cast<unsigned>(second_of_day / 60 % 60);
+        const unsigned s = static_cast<unsigned>(second_of_day % 60);
+        const std::uint8_t next_hour = hour_.next[h];
+        if (next_hour == none) {
+            t = (days + 1) * day;
+            continue;
+        }
+        if (next_hour != h) {
+            t = days * day + next_hour * 3600;
+            continue;
+        }
+        const std::uint8_t next_minute = minute_.next[mi];
+        if (next_minute == none) {
+            t = days * day + (h + 1) * 3600;
+            continue;
+        }
+        if (next_minute != mi) {
+            t = days * day + h * 3600 + next_minute * 60;
+            continue;
+        }
+        const std::uint8_t next_second = second_.next[s];
+        if (next_second == none) {
+            t = days * day + h * 3600 + (mi + 1) * 60;
+            continue;
+        }
+        return clock_type::time_point(seconds(days * day + h * 3600 + mi * 60 + next_second - offset_seconds_));
+    }
+    return clock_type::time_point::max();
+}
+
+#endif // CRON_SCHEDULE_HPP
@@ -0,0 +1,88 @@
+#ifndef EXECUTOR_POLICIES_HPP
+#define EXECUTOR_POLICIES_HPP
+#include "InplaceFunction.hpp"
+#include <chrono>
+#include <functional>
+#include <mutex>
+
+/**
+ * @file
+ * @brief Compile-time configuration policies for the PeriodicExecutor class template.
+ */
+
+/**
+ * @brief Selects what `\`PeriodicExecutor\`` does with deadlines that passed while a
+ * callback overran.
+ */
+enum class OverrunPolicy {
+    CatchUp, /**< @brief Run every missed deadline back to back until the executor is on time again. */
+    Skip     /**< @brief Drop the missed deadlines and continue with the next grid point after now. */
+};
+
+/**
+ * @brief A mutex whose operations do nothing, for executors controlled from one thread.
+ *
+ * @details Satisfies the `\`Lockable\`` requirements, so `\`std::lock_guard<NullMutex>\``
+ * compiles to nothing. The worker then shares no lock with the controlling thread:
+ * pause and resume requests and the end of a bounded run are not synchronized with
+ * `\`start()\`` and `\`stop()\``. Call `\`stop()\`` or restart a bounded run only once
+ * `\`finished()\`` has returned `true`.
+ */
+struct NullMutex {
+    void lock() noexcept {}
+    void unlock() noexcept {}
+    bool try_lock() noexcept { return true; }
+};
+
+/**
+ * @brief The default configuration of `\`PeriodicExecutor\``.
+ *
+ * @details A policy is a struct with the members below; derive from this one and
+ * override only what differs. Every disabled feature is removed with `\`if constexpr\``,
+ * so its hot-path code and runtime checks are not compiled at all, and the functions
+ * that configure it fail to compile if used.
+ */
+struct DefaultExecutorPolicies {
+    using clock_type = std::chrono::steady_clock;
+    /**< @brief The clock of the executor's `\`basic_waitable_timer\`` and of all deadlines. */
+    using callable_type = std::function<void()>;
+    /**< @brief The stored callback; e.g. `\`InplaceFunction<void()>\`` avoids heap storage. */
+    using control_mutex = std::mutex;
+    /**< @brief Serializes the control functions with each other and with the worker; see `\`NullMutex\``. */
+    static constexpr OverrunPolicy overrun = OverrunPolicy::CatchUp;
+    /**< @brief The handling of deadlines missed during an overrun. */
+    static constexpr bool stats = true;
+    /**< @brief Maintain the counters read by `\`stats()\``. */
+    static constexpr bool tracing = true;
+    /**< @brief Support the per-execution hooks: watchdog, timing ring and checkpoint. */
+    static constexpr bool single_threaded = false;
+    /**< @brief Drop the strand and the context's reactor I/O locking; needs the internal `\`io_context\``. */
+};
+
+/**
+ * @brief The smallest configuration: no stats, no hooks, an inline callback, no control lock.
+ */
+struct MinimalExecutorPolicies : DefaultExecutorPolicies {
+    using callable_type = InplaceFunction<void()>;
+    using control_mutex = NullMutex;
+    static constexpr bool stats = false;
+    static constexpr bool tracing = false;
+};
+
+/**
+ * @brief The minimal configuration without a strand, for executors that own their context.
+ */
+struct SingleThreadedExecutorPolicies : MinimalExecutorPolicies {
+    static constexpr bool single_threaded = true;
+};
+
+/**
+ * @brief Every feature enabled and control functions safe from several threads.
+ * @details Currently the same as `\`DefaultExecutorPolicies\``; it stays fully featured
+ * if the defaults are ever slimmed down.
+ */
+struct FullExecutorPolicies : DefaultExecutorPolicies {
+    using control_mutex = std::mutex;
+};
+
+#endif // EXECUTOR_POLICIES_HPP
@@ -0,0 +1,225 @@
+#ifndef INPLACE_FUNCTION_HPP
+#define INPLACE_FUNCTION_HPP
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file
+ * @brief Header file for the InplaceFunction class template.
+ */
+
+template <typename Signature, std::size_t Capacity = 64>
+class InplaceFunction;
+
+/**
+ * @class InplaceFunction
+ * @brief A move-only `\`std::function\`` replacement that stores the callable inline.
+ *
+ * @details `\`std::function\`` moves callables larger than its small buffer (two
+ * pointers in libstdc++) to the heap. `\`InplaceFunction\`` instead reserves
+ * `\`Capacity\`` bytes inside the object and rejects larger callables at compile time,
+ * so constructing, moving, calling and destroying it never allocates. Dispatch goes
+ * through two plain function pointers, one for the call and one for move/destroy.
+ *
+ * @tparam R The return type.
+ * @tparam Args The argument types.
+ * @tparam Capacity The inline storage in bytes.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+public:
+    /**
+     * @brief Constructs an empty function.
+     */
+    InplaceFunction() noexcept = default;
+
+    /**
+     * @brief Constructs an empty function.
+     */
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Stores `\`callable\`` inline.
+     * @details Fails to compile if the callable exceeds `\`Capacity\`` or
+     * `\`alignof(std::max_align_t)\``, or cannot be moved without throwing.
+     * @param[in] callable Any callable invocable as `\`R(Args...)\``.
+     */
+    template <typename F,
+              typename = std::enable_if_t<!std::is_same<std::decay_t<F>, InplaceFunction>::value &&
+                                          !std::is_same<std::decay_t<F>, std::nullptr_t>::value>>
+    InplaceFunction(F&& callable);
+
+    /**
+     * @brief Moves the callable out of `\`other\``, which becomes empty.
+     */
+    InplaceFunction(InplaceFunction&& other) noexcept;
+
+    /**
+     * @brief Destroys the current callable and moves in the one from `\`other\``.
+     */
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept;
+
+    /**
+     * @brief Destroys the current callable.
+     */
+    InplaceFunction& operator=(std::nullptr_t) noexcept;
+
+    /**
+     * @brief Destructor for `InplaceFunction`.
+     */
+    ~InplaceFunction();
+
+    /**
+     * @brief Calls the stored callable. Must not be called on an empty function.
+     */
+    R operator()(Args... args) const;
+
+    /**
+     * @brief Reports whether a callable is stored.
+     */
+    explicit operator bool() const noexcept;
+
+    // Copying would need a third function pointer and copyable callables; the
+    // schedulers only ever move their callbacks.
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+private:
+    /**
+     * @brief Invokes the callable stored at the given address.
+     */
+    using Invoker = R (*)(void*, Args&&...);
+
+    /**
+     * @brief Move-constructs the callable from `\`source\`` into `\`target\`` and destroys the
+     * source; with a null `\`target\`` it only destroys the source.
+     */
+    using Manager = void (*)(void* target, void* source);
+
+    /**
+     * @brief Destroys the stored callable, if any.
+     */
+    void reset() noexcept;
+
+    alignas(std::max_align_t) mutable unsigned char storage_[Capacity];
+    /**< @brief The inline storage holding the callable. */
+    Invoker invoke_ = nullptr;
+    /**< @brief Calls the callable; `\`nullptr\`` if empty. */
+    Manager manage_ = nullptr;
+    /**< @brief Moves or destroys the callable; `\`nullptr\`` if empty. */
+};
+
+// InplaceFunction Implementation
+
+/**
+ * @fn InplaceFunction::InplaceFunction(F&& callable)
+ * @brief Placement-constructs the callable and instantiates its invoker and manager.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+template <typename F, typename>
+InplaceFunction<R(Args...), Capacity>::InplaceFunction(F&& callable) {
+    using Callable = std::decay_t<F>;
+    static_assert(sizeof(Callable) <= Capacity, "callable does not fit into the InplaceFunction capacity");
+    static_assert(alignof(Callable) <= alignof(std::max_align_t), "callable is over-aligned for InplaceFunction");
+    static_assert(std::is_nothrow_move_constructible<Callable>::value,
+                  "InplaceFunction callables must be nothrow move constructible");
+
+    ::new (static_cast<void*>(storage_)) Callable(std::forward<F>(callable));
+    invoke_ = [](void* object, Args&&... args) -> R {
+        return (*static_cast<Callable*>(object))(std::forward<Args>(args)...);
+    };
+    manage_ = [](void* target, void* source) {
+        Callable* from = static_cast<Callable*>(source);
+        if (target != nullptr) {
+            ::new (target) Callable(std::move(*from));
+        }
+        from->~Callable();
+    };
+}
+
+/**
+ * @fn InplaceFunction::InplaceFunction(InplaceFunction&& other)
+ * @brief Relocates the callable from `\`other\``.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+InplaceFunction<R(Args...), Capacity>::InplaceFunction(InplaceFunction&& other) noexcept
+    : invoke_(other.invoke_), manage_(other.manage_) {
+    if (manage_ != nullptr) {
+        manage_(storage_, other.storage_);
+        other.invoke_ = nullptr;
+        other.manage_ = nullptr;
+    }
+}
+
+/**
+ * @fn InplaceFunction::operator=(InplaceFunction&& other)
+ * @brief Replaces the callable with the one from `\`other\``.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+InplaceFunction<R(Args...), Capacity>& InplaceFunction<R(Args...), Capacity>::operator=(InplaceFunction&& other) noexcept {
+    if (this != &other) {
+        reset();
+        if (other.manage_ != nullptr) {
+            other.manage_(storage_, other.storage_);
+            invoke_ = other.invoke_;
+            manage_ = other.manage_;
+            other.invoke_ = nullptr;
+            other.manage_ = nullptr;
+        }
+    }
+    return *this;
+}
+
+/**
+ * @fn InplaceFunction::operator=(std::nullptr_t)
+ * @brief Empties the function.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+InplaceFunction<R(Args...), Capacity>& InplaceFunction<R(Args...), Capacity>::operator=(std::nullptr_t) noexcept {
+    reset();
+    return *this;
+}
+
+/**
+ * @fn InplaceFunction::~InplaceFunction()
+ * @brief Destroys the stored callable.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+InplaceFunction<R(Args...), Capacity>::~InplaceFunction() {
+    reset();
+}
+
+/**
+ * @fn InplaceFunction::operator()(Args... args) const
+ * @brief Forwards the arguments to the stored callable.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+R InplaceFunction<R(Args...), Capacity>::operator()(Args... args) const {
+    return invoke_(storage_, std::forward<Args>(args)...);
+}
+
+/**
+ * @fn InplaceFunction::operator bool() const
+ * @brief Reports whether a callable is stored.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+InplaceFunction<R(Args...), Capacity>::operator bool() const noexcept {
+    return invoke_ != nullptr;
+}
+
+/**
+ * @fn InplaceFunction::reset()
+ * @brief Destroys the stored callable and empties the function.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+void InplaceFunction<R(Args...), Capacity>::reset() noexcept {
+    if (manage_ != nullptr) {
+        manage_(nullptr, storage_);
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+}
+
+#endif // INPLACE_FUNCTION_HPP
@@ -2,18 +2,92 @@
 #define PERIODIC_EXECUTOR_HPP
 #include <boost/asio.hpp>
 #include <boost/thread.hpp>
+#include "ExecutorPolicies.hpp"
+#include "ScheduleCheckpoint.hpp"
+#include "TimingRing.hpp"
+#include "Watchdog.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <chrono>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 
 /**
  * @file
  * @brief Header file for the PeriodicExecutor class template.
  */
 
+/**
+ * @brief Selects how `\`PeriodicExecutor::resume()\`` re-arms the timer after a pause.
+ */
+enum class ResumeMode {
+    Restart,       /**< @brief Re-arm one full interval after `\`resume()\``; the schedule phase shifts. */
+    PreservePhase, /**< @brief Re-arm to the next deadline on the original grid `\`start + k*interval\``. */
+    CatchUp        /**< @brief As `\`PreservePhase\``, but fire immediately if a deadline was missed while paused. */
+};
+
+/**
+ * @brief Selects the distribution of the random offset added to each deadline.
+ */
+enum class JitterDistribution {
+    None,       /**< @brief No jitter; every deadline lies exactly on the grid. */
+    Uniform,    /**< @brief Offsets uniformly distributed in `\`[0, max_jitter]\``. */
+    Exponential /**< @brief Exponential offsets with mean `\`max_jitter / 4\``, truncated at `\`max_jitter\``. */
+};
+
+/**
+ * @brief Feedback returned by an adaptive callback, see `\`AdaptiveInterval\``.
+ */
+enum class PollResult {
+    Idle,     /**< @brief The callback found nothing to do; the interval backs off. */
+    WorkFound /**< @brief The callback found work; the interval speeds up. */
+};
+
+/**
+ * @brief Bounds and step sizes for an adaptive polling interval.
+ *
+ * @details After an `\`Idle\`` result the interval is multiplied by `\`backoff_factor\``
+ * (rounded up), after `\`WorkFound\`` it is reduced by `\`speedup_step\``; in both cases
+ * it is clamped to `\`[min_interval, max_interval]\``. The executor starts at `\`min_interval\``.
+ * `\`min_interval\`` must be positive and not above `\`max_interval\``, `\`backoff_factor\``
+ * at least `\`1\`` and `\`speedup_step\`` not negative.
+ */
+struct AdaptiveInterval {
+    std::chrono::milliseconds min_interval;
+    /**< @brief The shortest interval, used while work keeps arriving. */
+    std::chrono::milliseconds max_interval;
+    /**< @brief The longest interval, reached after repeated idle polls. */
+    double backoff_factor = 2.0;
+    /**< @brief Multiplicative increase after an idle poll. */
+    std::chrono::milliseconds speedup_step = std::chrono::milliseconds(1);
+    /**< @brief Additive decrease after a poll that found work. */
+};
+
+/**
+ * @brief A snapshot of an executor's runtime statistics, see `\`PeriodicExecutor::stats()\``.
+ */
+struct ExecutorStats {
+    std::uint64_t tick_count;
+    /**< @brief The number of callback executions since `\`start()\``. */
+    std::chrono::milliseconds current_interval;
+    /**< @brief The interval currently used to re-arm the timer. */
+    double effective_rate_hz;
+    /**< @brief The execution rate implied by `\`current_interval\``. */
+};
+
 /**
  * @class PeriodicExecutor
  * @tparam Executor The type of the Boost.Asio executor to use for scheduling.
+ * @tparam Policies The compile-time configuration, see `\`DefaultExecutorPolicies\``.
  * @brief Provides a robust, thread-safe service for periodic task execution.
  *
  * @details The `PeriodicExecutor` encapsulates the complexity of thread management
@@ -23,19 +97,52 @@
  * The class uses a dedicated worker thread, a `\`work_guard\`` for lifecycle
  * management, and a `\`strand\`` to guarantee that the user-provided callback
  * is always executed serially, preventing potential data races.
+ *
+ * The `\`Policies\`` parameter selects the clock, the callback type, the overrun
+ * handling, whether stats and per-execution hooks are maintained and how control
+ * functions are serialized. Disabled features are compiled out rather than skipped
+ * at runtime, so `\`PeriodicExecutor<Executor, MinimalExecutorPolicies>\`` carries
+ * no code for them in its timer handler.
+ *
+ * With `\`Policies::single_threaded\`` the executor relies on owning its `\`io_context\``
+ * and the only thread running it: the strand is dropped, the context is created with
+ * `\`BOOST_ASIO_CONCURRENCY_HINT_UNSAFE_IO\`` and `\`pause()\``/`\`resume()\`` hand their
+ * request to the worker through a lock-free mailbox instead of touching the timer.
+ *
+ * The members are grouped by writer into blocks that each start a cache line: the
+ * read-mostly configuration, the state the worker updates on every execution, and
+ * the state the control functions update. The object is therefore cache-line aligned,
+ * and executors kept side by side in an array never share a line.
  */
-template <typename Executor = boost::asio::io_context::executor_type>
+template <typename Executor = boost::asio::io_context::executor_type, typename Policies = DefaultExecutorPolicies>
 class PeriodicExecutor {
 public:
+    /**
+     * @brief The clock of all deadlines, selected by `\`Policies::clock_type\``.
+     */
+    using clock_type = typename Policies::clock_type;
+
+    /**
+     * @brief A point in time on `\`clock_type\``.
+     */
+    using time_point = typename clock_type::time_point;
+
+    /**
+     * @brief The stored callback type, selected by `\`Policies::callable_type\``.
+     */
+    using callable_type = typename Policies::callable_type;
+
     /**
      * @brief Constructs a new `PeriodicExecutor` instance using the internal executor.
-     * @details This is the default constructor. It initializes the `\`strand_\`` using the
-     * executor provided by the internal `\`io_context_\``.
+     * @details This is the default constructor. The `\`io_context\``, its timer and the
+     * `\`strand\`` are created by the first `\`start()\``, so an idle executor holds no
+     * file descriptors, threads or heap memory.
      */
     PeriodicExecutor();
 
     /**
      * @brief Constructs a new `PeriodicExecutor` instance using an external executor.
+     * @details Not available with `\`Policies::single_threaded\``.
      * @param[in] executor The Boost.Asio executor to use for scheduling tasks. This
      * allows the periodic task to be executed on an external thread pool or context.
      */
@@ -60,7 +167,61 @@ public:
      * @return A boolean indicating if the executor was started successfully (`true`)
      * or was already running (`false`).
      */
-    bool start(std::chrono::milliseconds interval, std::function<void()> callback);
+    bool start(std::chrono::milliseconds interval, callable_type callback);
+
+    /**
+     * @brief Starts an adaptive poller whose interval follows the callback's feedback.
+     *
+     * @details The callback reports whether it found work. The interval starts at
+     * `\`config.min_interval\`` and is adjusted after every execution as described for
+     * `\`AdaptiveInterval\``, so an idle poller backs off towards `\`config.max_interval\``
+     * and a busy one converges on `\`config.min_interval\``. The next deadline is still
+     * computed from the previous one, so the adjustment adds no drift.
+     *
+     * @param[in] config The interval bounds and step sizes.
+     * @param[in] callback The polling function.
+     * @return `true` if started, `false` if the executor was already running.
+     * @throws std::invalid_argument If `\`config\`` breaks the constraints of `\`AdaptiveInterval\``.
+     */
+    bool start(AdaptiveInterval config, std::function<PollResult()> callback);
+
+    /**
+     * @brief Starts a bounded run that executes the task exactly `\`runs\`` times.
+     *
+     * @details After the last execution the timer is not re-armed, the callback is
+     * released and the worker thread exits on its own; `\`finished()\`` then returns
+     * `true` and the executor no longer counts as running, so `\`start()\`` may be called
+     * again right away. No counter in the callback and no second thread calling
+     * `\`stop()\`` are needed. The exited worker is joined and the `\`io_context\`` closed
+     * by the next `\`start()\``, `\`stop()\`` or the destructor; `\`stop()\`` may be called
+     * at any time.
+     *
+     * @param[in] interval The time interval (duration) between task executions.
+     * @param[in] runs The number of executions; `\`0\`` means unbounded.
+     * @param[in] callback The function to execute.
+     * @return `true` if started, `false` if the executor was already running.
+     */
+    bool start(std::chrono::milliseconds interval, std::size_t runs, callable_type callback);
+
+    /**
+     * @brief Starts a bounded run that executes the task on every deadline up to `\`until\``.
+     *
+     * @details Deadlines after `\`until\`` are not executed; the executor then finishes
+     * as described for the run-count variant.
+     *
+     * @param[in] interval The time interval (duration) between task executions.
+     * @param[in] until The last time at which a deadline may lie.
+     * @param[in] callback The function to execute.
+     * @return `true` if started, `false` if the executor was already running.
+     */
+    bool start_until(std::chrono::milliseconds interval, time_point until, callable_type callback);
+
+    /**
+     * @brief Reports whether a bounded run has completed.
+     * @details Safe to call from any thread.
+     * @return `true` once the last execution of a bounded run has returned.
+     */
+    bool finished() const;
 
     /**
      * @brief Stops the periodic execution and safely joins the worker thread.
@@ -68,7 +229,8 @@ public:
      * @details This function performs a coordinated, graceful shutdown: it cancels the
      * pending asynchronous wait, signals the `\`io_context\`` to stop processing tasks
      * (by resetting the `\`work_guard\``), and then blocks until the worker thread
-     * completes its execution using `\`thread::join()\``.
+     * completes its execution using `\`thread::join()\``. The `\`io_context\`` and the
+     * timer are then destroyed, which closes their file descriptors.
      * Can be called multiple times.
      */
     void stop();
@@ -80,18 +242,103 @@ public:
      * scheduled execution of the task. The underlying worker thread remains alive
      * and the `\`io_context\`` stays active.
      * This function has no effect if the executor is not running or is already paused.
+     * With `\`Policies::single_threaded\`` the worker applies the pause shortly after
+     * this call returns.
      */
     void pause();
 
     /**
      * @brief Resumes the periodic execution.
      *
-     * @details This function re-arms the `\`steady_timer\`` to expire after the defined
-     * interval, effectively restarting the periodic loop. The task will be executed
+     * @details This function re-arms the `\`steady_timer\`` according to `\`mode\``,
+     * effectively restarting the periodic loop. The task will be executed
      * again at the specified frequency.
      * This function has no effect if the executor is not running or is not paused.
+     * With `\`Policies::single_threaded\`` the worker applies it asynchronously, and a
+     * `\`pause()\`` still in the mailbox is replaced rather than followed.
+     *
+     * @param[in] mode How the first deadline after the pause is chosen. The default,
+     * `\`ResumeMode::Restart\``, waits one full interval from now; the other modes keep
+     * the executor aligned to the grid established by `\`start()\``.
+     */
+    void resume(ResumeMode mode = ResumeMode::Restart);
+
+    /**
+     * @brief Sets the stack size of the worker thread.
+     *
+     * @details The platform default (8 MiB on Linux) is reserved as address space for
+     * every worker; executors whose callbacks need little stack can ask for less, e.g.
+     * 64 KiB. The size is passed to `\`boost::thread::attributes\``, which rounds it up to
+     * the platform minimum and page size. Should be called before `\`start()\``.
+     *
+     * @param[in] bytes The stack size; `\`0\`` keeps the platform default.
      */
-    void resume();
+    void set_stack_size(std::size_t bytes);
+
+    /**
+     * @brief Adds bounded random jitter to every deadline.
+     *
+     * @details Decorrelates executors that were started at the same time, e.g. across
+     * a fleet of processes deployed together. The offset is drawn per deadline from a
+     * fast per-executor PRNG and added to the nominal grid point; the grid itself still
+     * advances by exactly one interval per execution, so the long-term average period
+     * is unchanged and jitter never accumulates into drift.
+     * Should be called before `\`start()\``.
+     *
+     * @param[in] distribution The offset distribution; `\`JitterDistribution::None\`` disables jitter.
+     * @param[in] max_jitter The largest offset added to a deadline.
+     */
+    void set_jitter(JitterDistribution distribution, std::chrono::microseconds max_jitter);
+
+    /**
+     * @brief Reports callbacks that run longer than `\`intervals\`` periods to a watchdog.
+     *
+     * @details Each execution is bracketed by two relaxed atomic stores into a slot of
+     * `\`watchdog\``, whose monitor thread reports executions that exceed the budget.
+     * The budget follows the current interval, including adaptive adjustments.
+     * Should be called before `\`start()\``.
+     *
+     * @param[in] watchdog The watchdog to register with; it may serve many executors.
+     * @param[in] intervals The budget in multiples of the interval.
+     * @param[in] name The name used in stall reports.
+     * @note Requires `\`Policies::tracing\``, as do `\`set_timing_ring()\`` and `\`set_checkpoint()\``.
+     */
+    void set_watchdog(Watchdog& watchdog, unsigned intervals = 3, std::string name = "PeriodicExecutor");
+
+    /**
+     * @brief Appends a `\`TimingRecord\`` for every execution to `\`ring\``.
+     *
+     * @details The record holds the armed deadline, the wake-up time, the callback's
+     * running time and the `\`Late\``/`\`Overrun\`` flags. Recording costs two clock
+     * reads and a few stores per tick; with a `\`TimingRingFile\``, other processes can
+     * follow the executor's timing live. Should be called before `\`start()\``.
+     *
+     * @param[in] ring The ring to write to, or `\`nullptr\`` to stop recording. It must
+     * outlive the executor's run and must not be written by anyone else.
+     */
+    void set_timing_ring(TimingRing* ring);
+
+    /**
+     * @brief Keeps the executor's grid in `\`checkpoint\`` across restarts.
+     *
+     * @details `\`start()\`` then continues the grid stored by a previous run with the
+     * same interval, possibly in an earlier process, instead of starting a new one at
+     * now; `\`checkpoint->missed()\`` reports the deadlines that passed in between. Each
+     * execution costs one relaxed store into the mapped file. Intended for fixed
+     * intervals; must be called before `\`start()\``.
+     *
+     * @param[in] checkpoint The checkpoint, or `\`nullptr\`` to start fresh grids again.
+     * It must outlive the executor's run.
+     */
+    void set_checkpoint(ScheduleCheckpoint* checkpoint);
+
+    /**
+     * @brief Returns runtime statistics.
+     * @details Safe to call from any thread while the executor runs. Requires
+     * `\`Policies::stats\``.
+     * @return The number of executions so far and the current interval and rate.
+     */
+    ExecutorStats stats() const;
 
     // Prevent copying and copy-assignment to maintain control over the single
     // worker thread and `io_context` instance.
@@ -99,13 +346,121 @@ public:
     PeriodicExecutor& operator=(const PeriodicExecutor&) = delete;
 
 private:
+    /**
+     * @brief The counters behind `\`stats()\``, present if `\`Policies::stats\`` is set.
+     */
+    struct StatsCounters {
+        std::atomic<std::uint64_t> tick_count{0};
+        /**< @brief Executions since `\`start()\``; written only by the worker. */
+        std::atomic<std::chrono::milliseconds::rep> current_interval_ms{0};
+        /**< @brief Mirror of `\`interval_\`` for `\`stats()\`` readers on other threads. */
+    };
+
+    /**
+     * @brief The per-execution hooks, present if `\`Policies::tracing\`` is set.
+     */
+    struct TracingHooks {
+        std::shared_ptr<Watchdog::Slot> watchdog_slot;
+        /**< @brief The slot marked around each execution; empty if no watchdog is set. */
+        unsigned watchdog_intervals = 0;
+        /**< @brief The watchdog budget in multiples of `\`interval_\``. */
+        TimingRing* timing_ring = nullptr;
+        /**< @brief Receives one record per execution; `\`nullptr\`` if timing is not recorded. */
+        ScheduleCheckpoint* checkpoint = nullptr;
+        /**< @brief Persists the grid and the last executed deadline; `\`nullptr\`` if not used. */
+    };
+
+    /**
+     * @brief Stands in for a disabled feature's state.
+     */
+    struct Disabled {};
+
+    /**
+     * @brief The strand type; no strand is needed with `\`Policies::single_threaded\``.
+     */
+    using strand_type = std::conditional_t<Policies::single_threaded, Disabled, boost::asio::strand<Executor>>;
+
+    /**
+     * @brief Creates the strand, or its placeholder.
+     * @param[in] executor The executor the strand serializes on.
+     */
+    template <typename Inner>
+    static strand_type make_strand(const Inner& executor);
+
+    /**
+     * @brief The Asio objects of a run, created by the first `\`start()\``.
+     */
+    struct Runtime {
+        boost::asio::io_context io_context;
+        /**< @brief Boost.Asio's execution context, managing the task queue. */
+        boost::asio::basic_waitable_timer<clock_type> timer;
+        /**< @brief The monotonic timer used to schedule periodic calls. */
+        boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard;
+        /**< @brief Prevents `\`io_context::run()\`` from exiting when there are no pending tasks. */
+        strand_type strand;
+        /**< @brief Guarantees serial execution of handlers, ensuring thread safety for the callback. */
+
+        /**
+         * @brief Creates the objects; the strand serializes on `\`executor\``, or on the
+         * internal context if it is empty.
+         */
+        explicit Runtime(const std::optional<Executor>& executor)
+            : io_context(Policies::single_threaded ? BOOST_ASIO_CONCURRENCY_HINT_UNSAFE_IO : BOOST_ASIO_CONCURRENCY_HINT_DEFAULT),
+              timer(io_context),
+              work_guard(boost::asio::make_work_guard(io_context)),
+              strand(executor ? make_strand(*executor) : make_strand(io_context.get_executor())) {}
+    };
+
+    /**
+     * @brief Mailbox command asking the worker to pause; `\`0\`` means "empty".
+     */
+    static constexpr std::uint32_t pause_command_ = 1;
+
+    /**
+     * @brief Mailbox command asking the worker to resume; the `\`ResumeMode\`` is added to it.
+     */
+    static constexpr std::uint32_t resume_command_ = 2;
+
+    /**
+     * @brief Deposits a command in the mailbox and wakes the worker if it was empty.
+     * @param[in] command `\`pause_command_\`` or `\`resume_command_\`` plus a `\`ResumeMode\``.
+     */
+    void post_command(std::uint32_t command);
+
+    /**
+     * @brief Applies the latest command from the mailbox. Runs on the worker.
+     */
+    void drain_mailbox();
+
+    /**
+     * @brief Cancels the wait and marks the executor paused.
+     */
+    void pause_now();
+
+    /**
+     * @brief Re-arms a paused executor according to `\`mode\``.
+     * @param[in] mode The re-arm strategy.
+     */
+    void resume_now(ResumeMode mode);
+
+    /**
+     * @brief Initializes the run and launches the worker thread.
+     * @details The caller holds `\`control_mutex_\`` and has checked `\`is_running_\``.
+     * @param[in] interval The time interval (duration) between task executions.
+     * @param[in] callback The periodic function to execute.
+     * @param[in] runs The number of executions; `\`0\`` for unbounded.
+     * @param[in] until The last time at which a deadline may lie.
+     */
+    void launch(std::chrono::milliseconds interval, callable_type callback, std::size_t runs = 0,
+                time_point until = time_point::max());
+
     /**
      * @brief The core handler function for the `\`async_wait\`` timer operation.
      *
      * @details This private member function is invoked by the `\`io_context\`` when the
      * `\`steady_timer\`` expires. It is responsible for three critical steps:
      * 1. Checking the `\`error\`` code for cancellation (`\`operation_aborted\``).
-     * 2. Executing the user's `\`callback_\`` (guaranteed to be sequential by the `\`strand_\``).
+     * 2. Executing the user's `\`callback_\`` (guaranteed to be sequential by the `\`strand\``).
      * 3. Re-arming the timer for the next execution cycle using `\`expires_at()\`` to prevent drift.
      *
      * @param[in] error The error code associated with the asynchronous operation. If non-zero,
@@ -113,24 +468,113 @@ private:
      */
     void handle_wait(const boost::system::error_code& error);
 
-    std::function<void()> callback_;
-    /**< @brief The user-supplied periodic task, stored as a generic `\`std::function\``. */
-    boost::asio::io_context io_context_;
-    /**< @brief Boost.Asio's execution context, managing the task queue. */
-    boost::asio::steady_timer timer_;
-    /**< @brief The monotonic timer used to schedule periodic calls. */
-    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_;
-    /**< @brief Prevents `\`io_context::run()\`` from exiting when there are no pending tasks. */
-    boost::asio::strand<Executor> strand_;
-    /**< @brief Guarantees serial execution of handlers, ensuring thread safety for the callback. */
-    boost::thread worker_thread_;
-    /**< @brief The dedicated thread that calls `\`io_context::run()\`` to execute tasks. */
+    /**
+     * @brief The callback of an adaptive run: polls and adjusts `\`interval_\``.
+     */
+    void poll_adaptive();
+
+    /**
+     * @brief Switches to a new interval on a grid anchored at the current deadline.
+     * @details Runs on the worker inside the callback, before the deadline is recorded.
+     * @param[in] interval The new interval.
+     */
+    void rebase_grid(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Arms the timer for `\`deadline_\`` plus a jitter offset and starts the wait.
+     */
+    void arm();
+
+    /**
+     * @brief Draws the jitter offset for the next deadline.
+     * @details Uses an xorshift64* generator seeded once per executor.
+     * @return The offset, zero if jitter is disabled.
+     */
+    std::chrono::microseconds jitter_offset();
+
+    /**
+     * @brief Ends a bounded run on the worker thread.
+     * @details Releases the callback and the work guard so that `\`io_context::run()\``
+     * returns and the worker thread exits, and marks the executor as not running.
+     */
+    void finish();
+
+    /**
+     * @brief Joins the worker of a finished bounded run and releases its `\`Runtime\``.
+     * @details The caller holds `\`control_mutex_\``. Does nothing while a run is active.
+     */
+    void reap();
+
+    /**
+     * @brief Waits until no handler on an external executor still uses a released `\`Runtime\``.
+     * @param[in] token Observes the released `\`Runtime\``; handlers hold it while they run.
+     */
+    static void await_handlers(const std::weak_ptr<Runtime>& token);
+
+    /**
+     * @brief Appends the timing of the execution that just ended to the timing ring.
+     * @param[in] woke The time the handler started.
+     */
+    void record_timing(time_point woke);
+
+    static constexpr std::size_t cache_line = 64;
+    /**< @brief The assumed cache-line size; each group of members below starts a new line. */
+
+    // Read-mostly: written by the control functions while the worker is not ticking.
+    alignas(cache_line) callable_type callback_;
+    /**< @brief The user-supplied periodic task, stored as `\`Policies::callable_type\``. */
+    std::function<PollResult()> poll_callback_;
+    /**< @brief The polling function of an adaptive run; empty otherwise. */
+    AdaptiveInterval adaptive_{};
+    /**< @brief The interval bounds and step sizes of an adaptive run. */
+    std::shared_ptr<Runtime> runtime_;
+    /**< @brief The context, timer and strand of the current run; empty until `\`start()\``. Handlers on an external executor hold it weakly. */
+    time_point until_ = time_point::max();
+    /**< @brief The last deadline a bounded run may execute. */
+    std::size_t runs_limit_ = 0;
+    /**< @brief The number of executions of a bounded run; `\`0\`` for unbounded. */
+    JitterDistribution jitter_ = JitterDistribution::None;
+    /**< @brief The distribution of the per-deadline jitter offset. */
+    std::chrono::microseconds max_jitter_{0};
+    /**< @brief The bound of the jitter offset. */
+    std::conditional_t<Policies::tracing, TracingHooks, Disabled> hooks_;
+    /**< @brief The watchdog, timing ring and checkpoint of this executor. */
+    std::optional<Executor> executor_;
+    /**< @brief The external executor the strand runs on; empty for the internal `\`io_context\``. */
+    std::size_t stack_size_ = 0;
+    /**< @brief The worker's stack size; `\`0\`` for the platform default. */
+
+    // Worker-written: updated on every execution.
+    alignas(cache_line) time_point anchor_;
+    /**< @brief The grid origin; deadlines lie on `\`anchor_ + k*interval_\``. Set by `\`start()\``, moved by adaptive interval changes. */
+    time_point deadline_;
+    /**< @brief The nominal deadline of the pending wait, before jitter is added. */
+    time_point expiry_;
+    /**< @brief The expiry handed to the timer for the pending wait, jitter included. */
     std::chrono::milliseconds interval_;
-    /**< @brief The desired period between task executions. */
+    /**< @brief The desired period between task executions; adapted by the worker in adaptive mode. */
+    std::uint64_t ticks_ = 0;
+    /**< @brief Executions since `\`start()\``; worker-only, ends bounded runs. */
+    std::uint64_t rng_state_ = 0;
+    /**< @brief State of the xorshift64* jitter generator; never zero once seeded. */
+    std::conditional_t<Policies::stats, StatsCounters, Disabled> stats_;
+    /**< @brief The counters published for `\`stats()\``. */
+    std::atomic<bool> finished_{false};
+    /**< @brief Set by the worker when a bounded run has completed. */
+
+    // Control-written: touched by start/stop/pause/resume and the handler's state checks.
+    alignas(cache_line) mutable typename Policies::control_mutex control_mutex_;
+    /**< @brief Serializes the control functions with each other and with the timer handler. */
     bool is_running_ = false;
     /**< @brief State flag indicating if the worker thread is active. */
     bool is_paused_ = false;
     /**< @brief State flag indicating if the timer loop is currently suspended. */
+    bool is_stopping_ = false;
+    /**< @brief Set while `\`stop()\`` tears the run down; handlers and `\`finish()\`` stand back. */
+    std::atomic<std::uint32_t> mailbox_{0};
+    /**< @brief The latest unapplied pause/resume request; single-threaded mode only. */
+    boost::thread worker_thread_;
+    /**< @brief The dedicated thread that calls `\`io_context::run()\`` to execute tasks. */
 };
 
 // PeriodicExecutor Implementation 
@@ -140,15 +584,11 @@ private:
  * @fn PeriodicExecutor::PeriodicExecutor()
  * @brief Constructs a new `PeriodicExecutor` instance using the internal executor.
  *
- * @details Initializes the `\`steady_timer\``, creates the `\`work_guard\`` to keep the
- * `\`io_context\`` alive, and initializes the `\`strand\`` using the internal
- * `\`io_context::get_executor()\`` to ensure sequential execution.
+ * @details Creates nothing; `\`launch()\`` builds the `\`Runtime\`` with a `\`strand\`` on the
+ * internal `\`io_context::get_executor()\`` to ensure sequential execution.
  */
-template <typename Executor>
-PeriodicExecutor<Executor>::PeriodicExecutor()
-    : timer_(io_context_),
-      work_guard_(boost::asio::make_work_guard(io_context_)),
-      strand_(io_context_.get_executor()) {}
+template <typename Executor, typename Policies>
+PeriodicExecutor<Executor, Policies>::PeriodicExecutor() = default;
 
 /**
  * @fn PeriodicExecutor::PeriodicExecutor(Executor executor)
@@ -156,15 +596,15 @@ PeriodicExecutor<Executor>::PeriodicExecutor()
  *
  * @details This constructor allows dependency injection of an `Executor`, enabling
  * the periodic task to integrate into an existing, potentially multi-threaded,
- * Boost.Asio execution context. The `\`strand\`` is initialized with this external
- * `\`Executor\`` to maintain the guarantee of serial execution of the task.
+ * Boost.Asio execution context. The executor is kept until `\`start()\``, which
+ * creates the `\`strand\`` on it to maintain the guarantee of serial execution of the task.
  * @param[in] executor The external Boost.Asio executor.
  */
-template <typename Executor>
-PeriodicExecutor<Executor>::PeriodicExecutor(Executor executor)
-    : timer_(io_context_),
-      work_guard_(boost::asio::make_work_guard(io_context_)),
-      strand_(executor) {}
+template <typename Executor, typename Policies>
+PeriodicExecutor<Executor, Policies>::PeriodicExecutor(Executor executor)
+    : executor_(std::move(executor)) {
+    static_assert(!Policies::single_threaded, "a single-threaded executor cannot run on an external executor");
+}
 
 /**
  * @fn PeriodicExecutor::~PeriodicExecutor()
@@ -174,45 +614,92 @@ PeriodicExecutor<Executor>::PeriodicExecutor(Executor executor)
  * before the object is destroyed. This is crucial for avoiding resource leaks
  * and undefined behavior from detached threads.
  */
-template <typename Executor>
-PeriodicExecutor<Executor>::~PeriodicExecutor() {
+template <typename Executor, typename Policies>
+PeriodicExecutor<Executor, Policies>::~PeriodicExecutor() {
     stop();
 }
 
 /**
- * @fn PeriodicExecutor::start(std::chrono::milliseconds interval, std::function<void()> callback)
+ * @fn PeriodicExecutor::start(std::chrono::milliseconds interval, callable_type callback)
  * @brief Starts the periodic execution.
  *
- * @details Initializes state variables, sets the timer's initial expiry time, and
- * launches the asynchronous loop by calling `\`async_wait()\``. The use of
- * `\`boost::asio::bind_executor(strand_,...)\`` guarantees the handler will execute
- * through the `\`strand\`` for thread safety. A `\`boost::thread\`` is then launched
- * to call `\`io_context::run()\``, isolating the task execution from the calling thread.
+ * @details Checks the state under `\`control_mutex_\`` and hands over to `\`launch()\``.
  * @param[in] interval The time interval (duration) between task executions.
  * @param[in] callback The periodic function to execute.
  * @return `true` if the executor started; `false` if it was already running.
  */
-template <typename Executor>
-bool PeriodicExecutor<Executor>::start(std::chrono::milliseconds interval, std::function<void()> callback) {
+template <typename Executor, typename Policies>
+bool PeriodicExecutor<Executor, Policies>::start(std::chrono::milliseconds interval, callable_type callback) {
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
     if (is_running_) {
         return false;
     }
+    reap();
+    launch(interval, std::move(callback));
+    return true;
+}
 
-    callback_ = callback;
+/**
+ * @fn PeriodicExecutor::launch(std::chrono::milliseconds interval, callable_type callback)
+ * @brief Initializes the run and launches the worker thread.
+ *
+ * @details Creates the `\`Runtime\``, initializes state variables, sets the timer's
+ * initial expiry time, and launches the asynchronous loop by calling `\`async_wait()\``.
+ * The use of `\`boost::asio::bind_executor(strand,...)\`` guarantees the handler will
+ * execute through the `\`strand\`` for thread safety. A `\`boost::thread\`` with the
+ * configured stack size is then launched to call `\`io_context::run()\``, isolating
+ * the task execution from the calling thread. The bounds are set on every run, so a
+ * plain `\`start()\`` after a bounded run is unbounded again.
+ * @param[in] interval The time interval (duration) between task executions.
+ * @param[in] callback The periodic function to execute.
+ * @param[in] runs The number of executions; `\`0\`` for unbounded.
+ * @param[in] until The last time at which a deadline may lie.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::launch(std::chrono::milliseconds interval, callable_type callback,
+                                                  std::size_t runs, time_point until) {
+    runtime_ = std::make_shared<Runtime>(executor_);
+    mailbox_.store(0, std::memory_order_relaxed);
+    callback_ = std::move(callback);
     interval_ = interval;
+    ticks_ = 0;
+    runs_limit_ = runs;
+    until_ = until;
+    finished_.store(false, std::memory_order_relaxed);
+    if constexpr (Policies::stats) {
+        stats_.current_interval_ms.store(interval_.count(), std::memory_order_relaxed);
+        stats_.tick_count.store(0, std::memory_order_relaxed);
+    }
     is_running_ = true;
     is_paused_ = false;
 
-    timer_.expires_after(interval_);
-    // Use bind_executor with the strand to ensure the handler is run serially.
-    timer_.async_wait(boost::asio::bind_executor(strand_, std::bind(&PeriodicExecutor::handle_wait, this, std::placeholders::_1)));
+    anchor_ = clock_type::now();
+    deadline_ = anchor_ + interval_;
+    if constexpr (Policies::tracing) {
+        if (hooks_.checkpoint != nullptr) {
+            const ScheduleResume resume = hooks_.checkpoint->begin(interval_);
+            if constexpr (std::is_same<clock_type, std::chrono::steady_clock>::value) {
+                anchor_ = resume.anchor;
+            } else {
+                // The checkpoint works on steady_clock; carry its anchor over by its age.
+                anchor_ -= std::chrono::duration_cast<typename clock_type::duration>(
+                    std::chrono::steady_clock::now() - resume.anchor);
+            }
+            deadline_ = anchor_ + interval_ * static_cast<std::int64_t>(resume.next_index);
+        }
+    }
+    arm();
 
    
     // Launch a new thread to run the io_context.
-    // The lambda function captures 'this' to correctly call io_context_.run().
-    worker_thread_ = boost::thread([this]() {
+    // The lambda function captures 'this' to correctly call io_context.run().
+    boost::thread::attributes attributes;
+    if (stack_size_ != 0) {
+        attributes.set_stack_size(stack_size_);
+    }
+    worker_thread_ = boost::thread(attributes, [this]() {
         try {
-            io_context_.run();
+            runtime_->io_context.run();
         } catch (const std::exception& ex) {
             std::cerr << "Exception caught in io_context.run(): " << ex.what() << std::endl;
             // Optional: log or handle recovery
@@ -221,10 +708,117 @@ bool PeriodicExecutor<Executor>::start(std::chrono::milliseconds interval, std::
             // Optional: fallback handling
         }
     });
+}
+
+
+/**
+ * @fn PeriodicExecutor::start(AdaptiveInterval config, std::function<PollResult()> callback)
+ * @brief Starts an adaptive poller.
+ *
+ * @details Wraps the polling function in a regular callback that applies the feedback
+ * to `\`interval_\`` after each execution. `\`handle_wait\`` reads `\`interval_\`` only after
+ * the callback returned, so the new value already applies to the next deadline. A
+ * changed interval starts a new grid at the current deadline, see `\`rebase_grid()\``.
+ * The configuration and the polling function are kept in members and the wrapper
+ * captures only `\`this\``, so it fits every `\`Policies::callable_type\``, including
+ * `\`InplaceFunction\``.
+ * @param[in] config The interval bounds and step sizes.
+ * @param[in] callback The polling function.
+ * @return `true` if the executor started; `false` if it was already running.
+ * @throws std::invalid_argument If the configuration is invalid; nothing is started.
+ */
+template <typename Executor, typename Policies>
+bool PeriodicExecutor<Executor, Policies>::start(AdaptiveInterval config, std::function<PollResult()> callback) {
+    // A zero interval would re-arm for the current deadline forever, and an inverted
+    // range would let the clamp return max_interval below min_interval.
+    if (config.min_interval.count() <= 0) {
+        throw std::invalid_argument("AdaptiveInterval: min_interval must be positive");
+    }
+    if (config.min_interval > config.max_interval) {
+        throw std::invalid_argument("AdaptiveInterval: min_interval exceeds max_interval");
+    }
+    if (!(config.backoff_factor >= 1.0) || config.speedup_step.count() < 0) {
+        throw std::invalid_argument("AdaptiveInterval: backoff_factor must be at least 1 and speedup_step not negative");
+    }
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    if (is_running_) {
+        return false;
+    }
+    reap();
+    adaptive_ = config;
+    poll_callback_ = std::move(callback);
+    launch(config.min_interval, [this]() { poll_adaptive(); });
+    return true;
+}
+
+/**
+ * @fn PeriodicExecutor::poll_adaptive()
+ * @brief Runs the polling function and applies its feedback to the interval.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::poll_adaptive() {
+    std::chrono::milliseconds next;
+    if (poll_callback_() == PollResult::Idle) {
+        next = std::chrono::milliseconds(
+            static_cast<std::chrono::milliseconds::rep>(std::ceil(interval_.count() * adaptive_.backoff_factor)));
+    } else {
+        next = interval_ - adaptive_.speedup_step;
+    }
+    next = std::min(std::max(next, adaptive_.min_interval), adaptive_.max_interval);
+    if (next != interval_) {
+        rebase_grid(next);
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::start(std::chrono::milliseconds interval, std::size_t runs, callable_type callback)
+ * @brief Starts a run with a fixed number of executions.
+ * @param[in] interval The time interval (duration) between task executions.
+ * @param[in] runs The number of executions; `\`0\`` means unbounded.
+ * @param[in] callback The function to execute.
+ * @return `true` if the executor started; `false` if it was already running.
+ */
+template <typename Executor, typename Policies>
+bool PeriodicExecutor<Executor, Policies>::start(std::chrono::milliseconds interval, std::size_t runs,
+                                                 callable_type callback) {
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    if (is_running_) {
+        return false;
+    }
+    reap();
+    launch(interval, std::move(callback), runs);
+    return true;
+}
 
+/**
+ * @fn PeriodicExecutor::start_until(std::chrono::milliseconds interval, time_point until, callable_type callback)
+ * @brief Starts a run that ends at an absolute time.
+ * @param[in] interval The time interval (duration) between task executions.
+ * @param[in] until The last time at which a deadline may lie.
+ * @param[in] callback The function to execute.
+ * @return `true` if the executor started; `false` if it was already running.
+ */
+template <typename Executor, typename Policies>
+bool PeriodicExecutor<Executor, Policies>::start_until(std::chrono::milliseconds interval, time_point until,
+                                                       callable_type callback) {
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    if (is_running_) {
+        return false;
+    }
+    reap();
+    launch(interval, std::move(callback), 0, until);
     return true;
 }
 
+/**
+ * @fn PeriodicExecutor::finished() const
+ * @brief Reports whether a bounded run has completed.
+ * @return `true` once the worker has ended the run.
+ */
+template <typename Executor, typename Policies>
+bool PeriodicExecutor<Executor, Policies>::finished() const {
+    return finished_.load(std::memory_order_acquire);
+}
 
 /**
  * @fn PeriodicExecutor::stop()
@@ -232,26 +826,62 @@ bool PeriodicExecutor<Executor>::start(std::chrono::milliseconds interval, std::
  *
  * @details This four-step shutdown process is essential for correct Boost.Asio
  * resource management:
- * 1. `\`timer_.cancel()\``: Cancels the pending wait, causing `\`handle_wait\`` to be called with `\`operation_aborted\``.
- * 2. `\`work_guard_.reset()\``: Releases the "work" object, allowing `\`io_context::run()\`` to eventually exit.
- * 3. `\`io_context_.stop()\``: Signals the context to cease all activity immediately.
+ * 1. `\`timer.cancel()\``: Cancels the pending wait, causing `\`handle_wait\`` to be called with `\`operation_aborted\``.
+ * 2. `\`work_guard.reset()\``: Releases the "work" object, allowing `\`io_context::run()\`` to eventually exit.
+ * 3. `\`io_context.stop()\``: Signals the context to cease all activity immediately.
  * 4. `\`worker_thread_.join()\``: Blocks until the worker thread has safely terminated, preventing a dangling thread.
+ *
+ * The join happens outside `\`control_mutex_\``, which the timer handler may still need.
+ * Finally the `\`Runtime\`` is released, which frees the context's file descriptors. After
+ * a finished bounded run, only the join and the release are left to do.
+ *
+ * On an external executor the handler runs on the strand, not on the worker, so the
+ * join does not wait for it. While `\`is_stopping_\`` is set, handlers that start do
+ * nothing, and a running one does not re-arm. A handler holds the `\`Runtime\`` only
+ * through a weak token, and `\`stop()\`` waits until every running handler has released
+ * it. Once `\`stop()\`` returns, no handler touches the executor again, so it may be
+ * destroyed. Handlers still queued on the strand find the token expired and return. The
+ * one exception is a `\`stop()\`` called from the callback itself: it cannot wait for
+ * its own handler, so it returns first and the handler exits after the callback.
  */
-template <typename Executor>
-void PeriodicExecutor<Executor>::stop() {
-    if (!is_running_) {
-        return;
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::stop() {
+    boost::thread worker;
+    {
+        std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+        if (!is_running_) {
+            reap();
+            return;
+        }
+        is_stopping_ = true;
+        runtime_->timer.cancel();
+        runtime_->work_guard.reset();
+        runtime_->io_context.stop();
+        worker = std::move(worker_thread_);
     }
-    timer_.cancel();
-    work_guard_.reset();
-    io_context_.stop();
 
-    if (worker_thread_.joinable()) {
-        worker_thread_.join();
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    std::weak_ptr<Runtime> token;
+    bool in_handler = false;
+    {
+        std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+        if constexpr (!Policies::single_threaded) {
+            in_handler = runtime_ && runtime_->strand.running_in_this_thread();
+        }
+        token = runtime_;
+        runtime_.reset();
+    }
+    if (!in_handler) {
+        await_handlers(token);
     }
 
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
     is_running_ = false;
     is_paused_ = false;
+    is_stopping_ = false;
 }
 
 /**
@@ -261,33 +891,223 @@ void PeriodicExecutor<Executor>::stop() {
  * @details Achieves pause functionality by cancelling the pending `\`async_wait\``
  * operation on the timer. The `\`handle_wait\`` function is designed to check the
  * `\`is_paused_\`` flag and the cancellation error, preventing the timer from
- * being re-armed until `\`resume()\`` is called.
+ * being re-armed until `\`resume()\`` is called. In single-threaded mode the timer is
+ * only touched by the worker, so the request goes through the mailbox.
  */
-template <typename Executor>
-void PeriodicExecutor<Executor>::pause() {
-    if (!is_running_ || is_paused_) {
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::pause() {
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    if (!is_running_) {
         return;
     }
-    timer_.cancel();
+    if constexpr (Policies::single_threaded) {
+        post_command(pause_command_);
+    } else {
+        pause_now();
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::pause_now()
+ * @brief Cancels the wait unless the executor is already paused.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::pause_now() {
+    if (is_paused_) {
+        return;
+    }
+    runtime_->timer.cancel();
     is_paused_ = true;
 }
 
 /**
- * @fn PeriodicExecutor::resume()
+ * @fn PeriodicExecutor::resume(ResumeMode mode)
  * @brief Resumes the periodic execution.
  *
  * @details Restarts the periodic loop by setting the `\`is_paused_\`` flag to `false`
- * and initiating a new `\`async_wait\`` operation. The new wait is scheduled immediately
- * relative to the current time.
+ * and initiating a new `\`async_wait\`` operation. With `\`ResumeMode::Restart\`` the new
+ * wait is scheduled relative to the current time. The grid-preserving modes instead
+ * compute the last grid point `\`anchor_ + k*interval_\`` that is not in the future and
+ * re-arm to the one after it. The timer still holds the deadline cancelled by
+ * `\`pause()\``; if that deadline has passed, `\`ResumeMode::CatchUp\`` arms the timer to
+ * the last grid point instead, so the handler fires immediately and its anti-drift
+ * re-arm lands back on the grid.
+ * @param[in] mode The re-arm strategy, see `\`ResumeMode\``.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::resume(ResumeMode mode) {
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    if (!is_running_) {
+        return;
+    }
+    if constexpr (Policies::single_threaded) {
+        post_command(resume_command_ + static_cast<std::uint32_t>(mode));
+    } else {
+        resume_now(mode);
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::resume_now(ResumeMode mode)
+ * @brief Re-arms the timer unless the executor is not paused or has finished.
+ * @param[in] mode The re-arm strategy.
  */
-template <typename Executor>
-void PeriodicExecutor<Executor>::resume() {
-    if (!is_running_ ||!is_paused_) {
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::resume_now(ResumeMode mode) {
+    if (!is_paused_ || finished_.load(std::memory_order_acquire)) {
         return;
     }
     is_paused_ = false;
-    timer_.expires_after(interval_);
-    timer_.async_wait(boost::asio::bind_executor(strand_, std::bind(&PeriodicExecutor::handle_wait, this, std::placeholders::_1)));
+    const auto now = clock_type::now();
+    if (mode == ResumeMode::Restart) {
+        deadline_ = now + interval_;
+    } else {
+        const auto last_deadline = anchor_ + ((now - anchor_) / interval_) * interval_;
+        const bool missed = deadline_ <= now;
+        if (mode == ResumeMode::CatchUp && missed) {
+            deadline_ = last_deadline;
+        } else {
+            deadline_ = last_deadline + interval_;
+        }
+    }
+    arm();
+}
+
+/**
+ * @fn PeriodicExecutor::post_command(std::uint32_t command)
+ * @brief Deposits a command in the mailbox.
+ *
+ * @details The mailbox holds only the latest request, which is all that matters for
+ * pause/resume. Only the request that finds it empty posts a drain to the
+ * `\`io_context\``; later ones overwrite the command and ride on that drain.
+ * @param[in] command The command.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::post_command(std::uint32_t command) {
+    if (mailbox_.exchange(command, std::memory_order_acq_rel) == 0) {
+        boost::asio::post(runtime_->io_context, [this]() { drain_mailbox(); });
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::drain_mailbox()
+ * @brief Empties the mailbox and applies its command on the worker.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::drain_mailbox() {
+    const std::uint32_t command = mailbox_.exchange(0, std::memory_order_acq_rel);
+    if (command == pause_command_) {
+        pause_now();
+    } else if (command >= resume_command_) {
+        resume_now(static_cast<ResumeMode>(command - resume_command_));
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::make_strand(const Inner& executor)
+ * @brief Creates the strand, or an empty placeholder in single-threaded mode.
+ * @param[in] executor The executor the strand serializes on.
+ * @return The strand.
+ */
+template <typename Executor, typename Policies>
+template <typename Inner>
+typename PeriodicExecutor<Executor, Policies>::strand_type
+PeriodicExecutor<Executor, Policies>::make_strand(const Inner& executor) {
+    if constexpr (Policies::single_threaded) {
+        return Disabled{};
+    } else {
+        return boost::asio::strand<Executor>(executor);
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::set_stack_size(std::size_t bytes)
+ * @brief Sets the stack size used for the next worker thread.
+ * @param[in] bytes The stack size; `\`0\`` for the platform default.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::set_stack_size(std::size_t bytes) {
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    stack_size_ = bytes;
+}
+
+/**
+ * @fn PeriodicExecutor::set_jitter(JitterDistribution distribution, std::chrono::microseconds max_jitter)
+ * @brief Configures the per-deadline jitter.
+ *
+ * @details Seeds the generator from the object address and the current time through
+ * a splitmix64 step, so executors created at the same instant in different processes
+ * or at different addresses draw different sequences.
+ * @param[in] distribution The offset distribution.
+ * @param[in] max_jitter The largest offset.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::set_jitter(JitterDistribution distribution, std::chrono::microseconds max_jitter) {
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    jitter_ = distribution;
+    max_jitter_ = max_jitter;
+    std::uint64_t seed = reinterpret_cast<std::uintptr_t>(this) ^
+        static_cast<std::uint64_t>(clock_type::now().time_since_epoch().count());
+    seed += 0x9E3779B97F4A7C15ull;
+    seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ull;
+    seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBull;
+    seed ^= seed >> 31;
+    rng_state_ = seed != 0 ? seed : 1;
+}
+
+/**
+ * @fn PeriodicExecutor::set_watchdog(Watchdog& watchdog, unsigned intervals, std::string name)
+ * @brief Registers the executor with a watchdog.
+ * @param[in] watchdog The watchdog to register with.
+ * @param[in] intervals The budget in multiples of the interval.
+ * @param[in] name The name used in stall reports.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::set_watchdog(Watchdog& watchdog, unsigned intervals, std::string name) {
+    static_assert(Policies::tracing, "set_watchdog() needs an executor policy with tracing enabled");
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    hooks_.watchdog_slot = watchdog.watch(std::move(name));
+    hooks_.watchdog_intervals = intervals;
+}
+
+/**
+ * @fn PeriodicExecutor::set_timing_ring(TimingRing* ring)
+ * @brief Sets the ring that receives one timing record per execution.
+ * @param[in] ring The ring, or `\`nullptr\``.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::set_timing_ring(TimingRing* ring) {
+    static_assert(Policies::tracing, "set_timing_ring() needs an executor policy with tracing enabled");
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    hooks_.timing_ring = ring;
+}
+
+/**
+ * @fn PeriodicExecutor::set_checkpoint(ScheduleCheckpoint* checkpoint)
+ * @brief Sets the checkpoint consulted by `\`start()\`` and updated by every execution.
+ * @param[in] checkpoint The checkpoint, or `\`nullptr\``.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::set_checkpoint(ScheduleCheckpoint* checkpoint) {
+    static_assert(Policies::tracing, "set_checkpoint() needs an executor policy with tracing enabled");
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    hooks_.checkpoint = checkpoint;
+}
+
+/**
+ * @fn PeriodicExecutor::stats() const
+ * @brief Returns runtime statistics.
+ *
+ * @details Reads the counters published by the worker with relaxed loads; the
+ * snapshot is consistent per field, not across fields.
+ * @return The statistics snapshot.
+ */
+template <typename Executor, typename Policies>
+ExecutorStats PeriodicExecutor<Executor, Policies>::stats() const {
+    static_assert(Policies::stats, "stats() needs an executor policy with stats enabled");
+    const std::chrono::milliseconds interval(stats_.current_interval_ms.load(std::memory_order_relaxed));
+    return ExecutorStats{stats_.tick_count.load(std::memory_order_relaxed), interval,
+                         interval.count() > 0 ? 1000.0 / interval.count() : 0.0};
 }
 
 /**
@@ -298,24 +1118,246 @@ void PeriodicExecutor<Executor>::resume() {
  * is `\`operation_aborted\`` (due to `\`stop()\`` or `\`pause()\``) or if the
  * system is explicitly paused, the function returns without re-arming the timer.
  * Otherwise, it executes the callback and sets the next expiry time relative to
- * the *previous* expiry time (`\`timer_.expiry()\``) to prevent timing drift.
+ * the *previous* expiry time (`\`timer.expiry()\``) to prevent timing drift. With
+ * `\`OverrunPolicy::Skip\``, deadlines that already passed are stepped over on the grid.
+ * The callback runs outside `\`control_mutex_\``, so it may call `\`pause()\``.
+ * While `\`stop()\`` is in progress the handler neither runs the callback nor re-arms;
+ * see `\`stop()\`` for how handlers on an external executor are kept off a destroyed
+ * executor.
  * @param[in] error The error code from the Boost.Asio asynchronous operation.
  */
-template <typename Executor>
-void PeriodicExecutor<Executor>::handle_wait(const boost::system::error_code& error) {
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::handle_wait(const boost::system::error_code& error) {
     // If the timer was canceled or the executor is paused, exit gracefully.
-    if (error == boost::asio::error::operation_aborted || is_paused_) {
+    {
+        std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+        if (error == boost::asio::error::operation_aborted || is_paused_ || !is_running_ || is_stopping_ || !runtime_) {
+            return;
+        }
+    }
+    if (deadline_ > until_) {
+        finish();
         return;
     }
 
     // Execute the user callback. The strand guarantees this is serialized (one thread at a time).
+    time_point woke;
+    if constexpr (Policies::tracing) {
+        if (hooks_.timing_ring != nullptr) {
+            woke = clock_type::now();
+        }
+        if (hooks_.watchdog_slot) {
+            hooks_.watchdog_slot->begin(interval_ * hooks_.watchdog_intervals);
+        }
+    }
     callback_();
+    if constexpr (Policies::tracing) {
+        if (hooks_.watchdog_slot) {
+            hooks_.watchdog_slot->end();
+        }
+        if (hooks_.timing_ring != nullptr) {
+            record_timing(woke);
+        }
+        if (hooks_.checkpoint != nullptr) {
+            hooks_.checkpoint->record(static_cast<std::uint64_t>((deadline_ - anchor_) / interval_));
+        }
+    }
+    ++ticks_;
+    if constexpr (Policies::stats) {
+        stats_.tick_count.store(ticks_, std::memory_order_relaxed);
+    }
+
+    // A bounded run ends here instead of waiting for a deadline it would not execute.
+    if ((runs_limit_ != 0 && ticks_ >= runs_limit_) || deadline_ + interval_ > until_) {
+        finish();
+        return;
+    }
 
     // Re-arm the timer for the next interval.
-    // Use timer_.expiry() to calculate the next expiry time relative to the old one,
+    // Use the previous nominal deadline to calculate the next one,
     // thereby maintaining the phase and avoiding clock drift.
-    timer_.expires_at(timer_.expiry() + interval_);
-    timer_.async_wait(boost::asio::bind_executor(strand_, std::bind(&PeriodicExecutor::handle_wait, this, std::placeholders::_1)));
+    deadline_ += interval_;
+    if constexpr (Policies::overrun == OverrunPolicy::Skip) {
+        const auto now = clock_type::now();
+        if (deadline_ <= now && interval_.count() > 0) {
+            deadline_ += ((now - deadline_) / interval_ + 1) * interval_;
+        }
+    }
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    if (!is_paused_ && is_running_ && !is_stopping_ && runtime_) { // the callback may have paused or stopped the executor
+        arm();
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::finish()
+ * @brief Ends a bounded run.
+ *
+ * @details Runs on the worker. With the timer idle and the work guard released, the
+ * `\`io_context\`` runs out of work and the worker thread returns without taking
+ * `\`control_mutex_\`` again, so `\`reap()\`` can join it while holding the mutex. If
+ * `\`stop()\`` is already tearing the run down, the run state is left to it.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::finish() {
+    std::lock_guard<typename Policies::control_mutex> lock(control_mutex_);
+    callback_ = nullptr;
+    poll_callback_ = nullptr;
+    finished_.store(true, std::memory_order_release);
+    if (is_stopping_ || !runtime_) {
+        return;
+    }
+    runtime_->work_guard.reset();
+    is_running_ = false;
+    is_paused_ = false;
+}
+
+/**
+ * @fn PeriodicExecutor::reap()
+ * @brief Joins the exited worker of a finished run and destroys its `\`Runtime\``.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::reap() {
+    if (is_running_) {
+        return;
+    }
+    if (worker_thread_.joinable()) {
+        worker_thread_.join();
+    }
+    // On an external executor the handler that finished the run may still be returning.
+    // It does not take the mutex again, so it can be waited for here.
+    std::weak_ptr<Runtime> token = runtime_;
+    runtime_.reset();
+    await_handlers(token);
+}
+
+/**
+ * @fn PeriodicExecutor::await_handlers(const std::weak_ptr<Runtime>& token)
+ * @brief Polls until the last handler holding the `\`Runtime\`` has released it.
+ *
+ * @details Only handlers on an external executor hold the token, and only while they
+ * run, so this returns at once for the internal `\`io_context\``.
+ * @param[in] token Observes the released `\`Runtime\``.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::await_handlers(const std::weak_ptr<Runtime>& token) {
+    while (!token.expired()) {
+        boost::this_thread::sleep_for(boost::chrono::microseconds(100));
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::rebase_grid(std::chrono::milliseconds interval)
+ * @brief Changes the interval and restarts the grid at `\`deadline_\``.
+ *
+ * @details The grid-preserving resume modes and the checkpoint index compute with
+ * `\`anchor_ + k*interval_\``, which only holds for the interval the grid was built with.
+ * Anchoring the new grid at the deadline being executed makes it index `\`0\``, and the
+ * checkpoint stores the new grid so that its indices stay meaningful.
+ * @param[in] interval The new interval.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::rebase_grid(std::chrono::milliseconds interval) {
+    anchor_ = deadline_;
+    interval_ = interval;
+    if constexpr (Policies::stats) {
+        stats_.current_interval_ms.store(interval_.count(), std::memory_order_relaxed);
+    }
+    if constexpr (Policies::tracing) {
+        if (hooks_.checkpoint != nullptr) {
+            if constexpr (std::is_same<clock_type, std::chrono::steady_clock>::value) {
+                hooks_.checkpoint->rebase(anchor_, interval_);
+            } else {
+                hooks_.checkpoint->rebase(std::chrono::steady_clock::now() -
+                                              std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                                  clock_type::now() - anchor_),
+                                          interval_);
+            }
+        }
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::record_timing(time_point woke)
+ * @brief Builds the timing record and appends it to the ring.
+ *
+ * @details The timer has not been re-armed yet, so `\`expiry_\`` is still the deadline
+ * of this execution, jitter included. It is read from the member rather than the timer,
+ * which `\`stop()\`` may already have destroyed.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::record_timing(time_point woke) {
+    const auto done = clock_type::now();
+    const auto deadline = expiry_;
+    TimingRecord record{};
+    record.deadline_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+    record.wake_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(woke.time_since_epoch()).count();
+    record.duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(done - woke).count();
+    if (woke - deadline > interval_) {
+        record.flags |= TimingRecord::Late;
+    }
+    if (done - woke > interval_) {
+        record.flags |= TimingRecord::Overrun;
+    }
+    hooks_.timing_ring->record(record);
+}
+
+/**
+ * @fn PeriodicExecutor::arm()
+ * @brief Arms the timer and starts the asynchronous wait.
+ *
+ * @details The jitter offset only affects the expiry handed to the timer; `\`deadline_\``
+ * keeps the nominal grid point, which is what the next deadline is computed from.
+ */
+template <typename Executor, typename Policies>
+void PeriodicExecutor<Executor, Policies>::arm() {
+    auto& timer = runtime_->timer;
+    expiry_ = deadline_ + jitter_offset();
+    timer.expires_at(expiry_);
+    if constexpr (Policies::single_threaded) {
+        // Only the worker runs the io_context, so handlers are serial without a strand.
+        timer.async_wait(std::bind(&PeriodicExecutor::handle_wait, this, std::placeholders::_1));
+    } else if (executor_) {
+        // On an external executor the handler may be queued past stop() and the executor's
+        // lifetime, so it only enters `handle_wait` while it can lock the run's Runtime.
+        timer.async_wait(boost::asio::bind_executor(
+            runtime_->strand, [this, token = std::weak_ptr<Runtime>(runtime_)](const boost::system::error_code& error) {
+                if (const auto runtime = token.lock()) {
+                    handle_wait(error);
+                }
+            }));
+    } else {
+        // Use bind_executor with the strand to ensure the handler is run serially.
+        timer.async_wait(boost::asio::bind_executor(runtime_->strand, std::bind(&PeriodicExecutor::handle_wait, this, std::placeholders::_1)));
+    }
+}
+
+/**
+ * @fn PeriodicExecutor::jitter_offset()
+ * @brief Draws the next jitter offset.
+ *
+ * @details One xorshift64* step yields 53 random bits that are mapped to `\`u\`` in
+ * `\`[0, 1)\``. Uniform jitter scales `\`u\``; exponential jitter uses the inverse CDF
+ * `\`-mean * ln(1 - u)\`` and clamps the rare tail beyond `\`max_jitter_\``.
+ * @return The offset for the next deadline.
+ */
+template <typename Executor, typename Policies>
+std::chrono::microseconds PeriodicExecutor<Executor, Policies>::jitter_offset() {
+    if (jitter_ == JitterDistribution::None || max_jitter_.count() <= 0) {
+        return std::chrono::microseconds::zero();
+    }
+    rng_state_ ^= rng_state_ >> 12;
+    rng_state_ ^= rng_state_ << 25;
+    rng_state_ ^= rng_state_ >> 27;
+    const double u = static_cast<double>((rng_state_ * 0x2545F4914F6CDD1Dull) >> 11) * 0x1.0p-53;
+    const double max = static_cast<double>(max_jitter_.count());
+    double offset;
+    if (jitter_ == JitterDistribution::Uniform) {
+        offset = u * max;
+    } else {
+        offset = std::min(-(max / 4.0) * std::log1p(-u), max);
+    }
+    return std::chrono::microseconds(static_cast<std::chrono::microseconds::rep>(offset));
 }
 
 #endif // PERIODIC_EXECUTOR_HPP
\ No newline at end of file
@@ -0,0 +1,533 @@
+#ifndef PERIODIC_FILE_WRITER_HPP
+#define PERIODIC_FILE_WRITER_HPP
+#include "PeriodicExecutor.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+#include <climits>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#if defined(PERIODIC_FILE_WRITER_USE_IO_URING) && __has_include(<liburing.h>)
+#include <liburing.h>
+#define PERIODIC_FILE_WRITER_HAS_IO_URING 1
+#else
+#define PERIODIC_FILE_WRITER_HAS_IO_URING 0
+#endif
+
+/**
+ * @file
+ * @brief Header file for the PeriodicFileWriter class (POSIX only).
+ */
+
+/**
+ * @brief Selects when a `\`PeriodicFileWriter\`` calls `\`fsync()\``.
+ */
+enum class FsyncPolicy {
+    EveryTick,   /**< @brief After every tick that wrote data. */
+    EveryNTicks, /**< @brief After every N-th tick, if data was written since the last sync. */
+    Never        /**< @brief Leave write-back to the operating system. */
+};
+
+/**
+ * @class PeriodicFileWriter
+ * @brief Queues records and appends them to a file once per tick with a single gathered write.
+ *
+ * @details Periodic tasks that log or persist small records typically issue one
+ * `\`write()\`` per record, often followed by `\`fsync()\``. Here `\`write()\`` only moves the
+ * record into a queue under a short mutex. On each tick the worker takes the whole
+ * queue and hands it to the kernel as one `\`writev()\`` (split only every `\`IOV_MAX\``
+ * records), optionally followed by one `\`fsync()\``, so the number of I/O syscalls
+ * scales with the number of ticks rather than the number of records.
+ *
+ * When built with `\`PERIODIC_FILE_WRITER_USE_IO_URING\`` and liburing is available, the
+ * gathered write and the fsync are submitted as a linked pair to an io_uring and reaped
+ * with one `\`io_uring_submit_and_wait()\``. If the ring cannot be set up the writer falls
+ * back to `\`writev()\`` transparently.
+ *
+ * I/O errors do not stop the tick; the affected batch is dropped and the error is
+ * available from `\`last_error()\``.
+ */
+class PeriodicFileWriter {
+public:
+    /**
+     * @brief Opens `\`path\`` for appending, creating it if necessary.
+     * @param[in] path The file to append to.
+     * @param[in] policy When to call `\`fsync()\``.
+     * @param[in] fsync_every The N of `\`FsyncPolicy::EveryNTicks\``.
+     * @throws std::system_error If the file cannot be opened.
+     */
+    explicit PeriodicFileWriter(const std::string& path, FsyncPolicy policy = FsyncPolicy::Never,
+                                unsigned fsync_every = 1);
+
+    /**
+     * @brief Destructor for `PeriodicFileWriter`.
+     * @details Calls `\`stop()\`` and closes the file.
+     */
+    ~PeriodicFileWriter();
+
+    /**
+     * @brief Starts the periodic flush.
+     * @param[in] interval The period between flushes.
+     * @return `true` if started, `false` if already running.
+     */
+    bool start(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Stops the periodic flush and writes the remaining records.
+     * @details Unless the policy is `\`FsyncPolicy::Never\``, the file is synced afterwards.
+     */
+    void stop();
+
+    /**
+     * @brief Queues a record; it is written verbatim, so include any separator.
+     * @details Safe to call from any thread.
+     * @param[in] record The bytes to append.
+     */
+    void write(std::string record);
+
+    /**
+     * @brief Returns the number of records written so far.
+     */
+    std::uint64_t records_written() const;
+
+    /**
+     * @brief Returns the number of write syscalls or io_uring submissions so far.
+     */
+    std::uint64_t write_calls() const;
+
+    /**
+     * @brief Returns the number of file syncs so far.
+     */
+    std::uint64_t fsync_calls() const;
+
+    /**
+     * @brief Returns the most recent I/O error, or an empty error code.
+     */
+    std::error_code last_error() const;
+
+    /**
+     * @brief Reports whether batches are submitted through io_uring.
+     * @details `\`false\`` if the backend is not compiled in, the ring could not be set up,
+     * or it was given up after an error. The worker may give the ring up at any tick, so
+     * the answer is only settled while the writer is stopped.
+     */
+    bool uses_io_uring() const;
+
+    // The writer owns a file descriptor and is referenced by its worker.
+    PeriodicFileWriter(const PeriodicFileWriter&) = delete;
+    PeriodicFileWriter& operator=(const PeriodicFileWriter&) = delete;
+
+private:
+    /**
+     * @brief Writes the queued records and syncs as the policy requires.
+     * @param[in] final `true` for the flush from `\`stop()\``, which always syncs unless the policy is never.
+     */
+    void flush(bool final);
+
+    /**
+     * @brief Consumes written bytes from the front of `\`iov_\``.
+     * @param[in] index The first unwritten entry.
+     * @param[in] bytes The number of bytes written from there.
+     * @return The new first unwritten entry.
+     */
+    std::size_t advance(std::size_t index, std::size_t bytes);
+
+    /**
+     * @brief Writes `\`iov_\`` from `\`index\`` on with `\`writev()\``, resuming after short writes.
+     * @param[in] index The first vector entry to write.
+     * @return `false` on error.
+     */
+    bool write_vectors(std::size_t index);
+
+    /**
+     * @brief Calls `\`fsync()\`` and counts it.
+     */
+    void sync();
+
+    /**
+     * @brief Records an I/O error.
+     * @param[in] error The `\`errno\`` value.
+     */
+    void fail(int error);
+
+#if PERIODIC_FILE_WRITER_HAS_IO_URING
+    /**
+     * @brief Submits the write, and the sync if requested, as one linked io_uring batch.
+     * @param[in] with_sync Whether to link an fsync to the write.
+     * @return `true` if the linked fsync completed, so no separate sync is needed.
+     */
+    bool submit_uring(bool with_sync);
+
+    /**
+     * @brief Releases the ring after an error and falls back to `\`writev()\``.
+     */
+    void abandon_uring();
+
+    struct io_uring ring_;
+    /**< @brief The submission and completion queues; valid if `\`uring_ready_\``. */
+    bool uring_ready_ = false;
+    /**< @brief Whether the ring is set up and in use. */
+#endif
+
+    int fd_;
+    /**< @brief The file, opened with `\`O_APPEND\``. */
+    FsyncPolicy policy_;
+    /**< @brief When to sync. */
+    unsigned fsync_every_;
+    /**< @brief The N of `\`FsyncPolicy::EveryNTicks\``. */
+    unsigned ticks_since_sync_ = 0;
+    /**< @brief Worker only: ticks since the last sync. */
+    bool dirty_ = false;
+    /**< @brief Worker only: data was written since the last sync. */
+    std::mutex queue_mutex_;
+    /**< @brief Protects `\`pending_\``. */
+    std::vector<std::string> pending_;
+    /**< @brief Records queued since the last flush. */
+    std::vector<std::string> writing_;
+    /**< @brief Worker only: the records being written; swapped with `\`pending_\``. */
+    std::vector<struct iovec> iov_;
+    /**< @brief Worker only: the gather list for `\`writing_\``, reused every tick. */
+    mutable std::mutex error_mutex_;
+    /**< @brief Protects `\`last_error_\``. */
+    std::error_code last_error_;
+    /**< @brief The most recent I/O error. */
+    std::atomic<std::uint64_t> records_written_{0};
+    /**< @brief Records written. */
+    std::atomic<std::uint64_t> write_calls_{0};
+    /**< @brief Write syscalls or io_uring submissions. */
+    std::atomic<std::uint64_t> fsync_calls_{0};
+    /**< @brief File syncs. */
+    PeriodicExecutor<> executor_;
+    /**< @brief Drives the flush; declared last so it stops before the file is closed. */
+};
+
+// PeriodicFileWriter Implementation
+
+/**
+ * @fn PeriodicFileWriter::PeriodicFileWriter(const std::string& path, FsyncPolicy policy, unsigned fsync_every)
+ * @brief Opens the file and, if enabled, sets up the io_uring.
+ */
+inline PeriodicFileWriter::PeriodicFileWriter(const std::string& path, FsyncPolicy policy, unsigned fsync_every)
+    : fd_(::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644)),
+      policy_(policy),
+      fsync_every_(fsync_every == 0 ? 1 : fsync_every) {
+    if (fd_ < 0) {
+        throw std::system_error(errno, std::generic_category(), "PeriodicFileWriter: cannot open " + path);
+    }
+#if PERIODIC_FILE_WRITER_HAS_IO_URING
+    uring_ready_ = io_uring_queue_init(4, &ring_, 0) == 0;
+#endif
+}
+
+/**
+ * @fn PeriodicFileWriter::~PeriodicFileWriter()
+ * @brief Writes the remaining records and closes the file.
+ */
+inline PeriodicFileWriter::~PeriodicFileWriter() {
+    stop();
+#if PERIODIC_FILE_WRITER_HAS_IO_URING
+    if (uring_ready_) {
+        io_uring_queue_exit(&ring_);
+    }
+#endif
+    ::close(fd_);
+}
+
+/**
+ * @fn PeriodicFileWriter::start(std::chrono::milliseconds interval)
+ * @brief Starts the executor with the periodic flush as its callback.
+ */
+inline bool PeriodicFileWriter::start(std::chrono::milliseconds interval) {
+    return executor_.start(interval, [this]() { flush(false); });
+}
+
+/**
+ * @fn PeriodicFileWriter::stop()
+ * @brief Stops the executor, then performs the final flush on the calling thread.
+ */
+inline void PeriodicFileWriter::stop() {
+    executor_.stop();
+    flush(true);
+}
+
+/**
+ * @fn PeriodicFileWriter::write(std::string record)
+ * @brief Moves the record into the queue.
+ */
+inline void PeriodicFileWriter::write(std::string record) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    pending_.push_back(std::move(record));
+}
+
+/**
+ * @fn PeriodicFileWriter::flush(bool final)
+ * @brief Takes the queue and writes it with one gathered write.
+ *
+ * @details The queue is swapped with the worker's vector, whose capacity is kept, so
+ * producers are blocked only for the swap. Empty records are left out of the gather
+ * list, which guarantees that every successful `\`writev()\`` makes progress.
+ * @param[in] final Whether this is the flush from `\`stop()\``.
+ */
+inline void PeriodicFileWriter::flush(bool final) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        writing_.swap(pending_);
+    }
+    iov_.clear();
+    for (std::string& record : writing_) {
+        if (!record.empty()) {
+            iov_.push_back(iovec{&record[0], record.size()});
+        }
+    }
+
+    ++ticks_since_sync_;
+    const bool wrote = !iov_.empty();
+    const bool sync_now = policy_ != FsyncPolicy::Never && (dirty_ || wrote) &&
+        (final || policy_ == FsyncPolicy::EveryTick || ticks_since_sync_ >= fsync_every_);
+    bool synced = false;
+    if (wrote) {
+#if PERIODIC_FILE_WRITER_HAS_IO_URING
+        if (uring_ready_ && iov_.size() <= IOV_MAX) {
+            synced = submit_uring(sync_now);
+        } else {
+            write_vectors(0);
+        }
+#else
+        write_vectors(0);
+#endif
+    } else {
+        records_written_.fetch_add(writing_.size(), std::memory_order_relaxed);
+    }
+    if (sync_now && !synced) {
+        sync();
+    }
+    writing_.clear();
+}
+
+/**
+ * @fn PeriodicFileWriter::advance(std::size_t index, std::size_t bytes)
+ * @brief Consumes `\`bytes\`` from the front of the gather list.
+ *
+ * @details Fully written entries are skipped and a partially written entry is trimmed
+ * at the front, so the list can be resubmitted after a short write.
+ */
+inline std::size_t PeriodicFileWriter::advance(std::size_t index, std::size_t bytes) {
+    while (bytes > 0) {
+        if (bytes >= iov_[index].iov_len) {
+            bytes -= iov_[index].iov_len;
+            ++index;
+        } else {
+            iov_[index].iov_base = static_cast<char*>(iov_[index].iov_base) + bytes;
+            iov_[index].iov_len -= bytes;
+            bytes = 0;
+        }
+    }
+    return index;
+}
+
+/**
+ * @fn PeriodicFileWriter::write_vectors(std::size_t index)
+ * @brief The `\`writev()\`` loop.
+ *
+ * @details Resumes after short writes and retries `\`EINTR\``. On success the batch
+ * is counted and the file marked as needing a sync; on error the rest of the batch
+ * is dropped.
+ * @param[in] index The first entry to write.
+ * @return `false` if a write failed.
+ */
+inline bool PeriodicFileWriter::write_vectors(std::size_t index) {
+    while (index < iov_.size()) {
+        const std::size_t count = std::min<std::size_t>(iov_.size() - index, IOV_MAX);
+        const ssize_t written = ::writev(fd_, &iov_[index], static_cast<int>(count));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            fail(errno);
+            return false;
+        }
+        write_calls_.fetch_add(1, std::memory_order_relaxed);
+        index = advance(index, static_cast<std::size_t>(written));
+    }
+    records_written_.fetch_add(writing_.size(), std::memory_order_relaxed);
+    dirty_ = true;
+    return true;
+}
+
+#if PERIODIC_FILE_WRITER_HAS_IO_URING
+/**
+ * @fn PeriodicFileWriter::submit_uring(bool with_sync)
+ * @brief Writes the batch, and syncs, with one io_uring submission.
+ *
+ * @details The fsync is linked to the write, so it only runs after the write has
+ * completed in full; after a short write the kernel cancels it, the remainder is
+ * written with `\`writev()\`` and the caller falls back to `\`fsync()\``. Completions
+ * are matched to their requests by `\`user_data\``, not by arrival order. Both SQEs
+ * are taken only if the queue has room for both, so a half-prepared pair is never
+ * left behind for the next submission. If the ring fails in a way that may leave a
+ * completion unreaped, it is torn down and later batches use `\`writev()\``; the
+ * current batch is then dropped like any other failed write.
+ * @param[in] with_sync Whether to link an fsync.
+ * @return `true` if the linked fsync completed successfully.
+ */
+inline bool PeriodicFileWriter::submit_uring(bool with_sync) {
+    constexpr __u64 write_tag = 1;
+    constexpr __u64 sync_tag = 2;
+    const unsigned expected = with_sync ? 2 : 1;
+    if (io_uring_sq_space_left(&ring_) < expected) {
+        write_vectors(0);
+        return false;
+    }
+    std::size_t total = 0;
+    for (const iovec& vector : iov_) {
+        total += vector.iov_len;
+    }
+    io_uring_sqe* write_sqe = io_uring_get_sqe(&ring_);
+    io_uring_prep_writev(write_sqe, fd_, iov_.data(), static_cast<unsigned>(iov_.size()), static_cast<__u64>(-1));
+    write_sqe->user_data = write_tag;
+    if (with_sync) {
+        write_sqe->flags |= IOSQE_IO_LINK;
+        io_uring_sqe* sync_sqe = io_uring_get_sqe(&ring_);
+        io_uring_prep_fsync(sync_sqe, fd_, 0);
+        sync_sqe->user_data = sync_tag;
+    }
+    int submitted = io_uring_submit_and_wait(&ring_, expected);
+    if (submitted == -EINTR && io_uring_sq_ready(&ring_) == 0) {
+        submitted = static_cast<int>(expected); // submitted, only the wait was interrupted
+    }
+    if (submitted < 0) {
+        fail(-submitted);
+        abandon_uring();
+        return false;
+    }
+    write_calls_.fetch_add(1, std::memory_order_relaxed);
+
+    int write_result = -ECANCELED;
+    int sync_result = -ECANCELED;
+    for (unsigned reaped = 0; reaped < expected;) {
+        io_uring_cqe* cqe = nullptr;
+        const int waited = io_uring_wait_cqe(&ring_, &cqe);
+        if (waited == -EINTR) {
+            continue;
+        }
+        if (waited != 0) {
+            fail(-waited);
+            abandon_uring();
+            return false;
+        }
+        if (cqe->user_data == write_tag) {
+            write_result = cqe->res;
+            ++reaped;
+        } else if (cqe->user_data == sync_tag) {
+            sync_result = cqe->res;
+            ++reaped;
+        }
+        io_uring_cqe_seen(&ring_, cqe);
+    }
+    if (write_result < 0) {
+        fail(-write_result);
+        return false;
+    }
+    if (static_cast<std::size_t>(write_result) < total) {
+        write_vectors(advance(0, static_cast<std::size_t>(write_result)));
+        return false;
+    }
+    records_written_.fetch_add(writing_.size(), std::memory_order_relaxed);
+    dirty_ = true;
+    if (!with_sync || sync_result < 0) {
+        return false;
+    }
+    fsync_calls_.fetch_add(1, std::memory_order_relaxed);
+    dirty_ = false;
+    ticks_since_sync_ = 0;
+    return true;
+}
+
+/**
+ * @fn PeriodicFileWriter::abandon_uring()
+ * @brief Tears down the ring so no stale completion can be matched to a later batch.
+ */
+inline void PeriodicFileWriter::abandon_uring() {
+    io_uring_queue_exit(&ring_);
+    uring_ready_ = false;
+}
+#endif
+
+/**
+ * @fn PeriodicFileWriter::sync()
+ * @brief Syncs the file and resets the sync bookkeeping.
+ */
+inline void PeriodicFileWriter::sync() {
+    if (::fsync(fd_) != 0) {
+        fail(errno);
+        return;
+    }
+    fsync_calls_.fetch_add(1, std::memory_order_relaxed);
+    dirty_ = false;
+    ticks_since_sync_ = 0;
+}
+
+/**
+ * @fn PeriodicFileWriter::fail(int error)
+ * @brief Stores the error for `\`last_error()\``.
+ */
+inline void PeriodicFileWriter::fail(int error) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    last_error_ = std::error_code(error, std::generic_category());
+}
+
+/**
+ * @fn PeriodicFileWriter::records_written() const
+ * @brief Reads the record counter.
+ */
+inline std::uint64_t PeriodicFileWriter::records_written() const {
+    return records_written_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @fn PeriodicFileWriter::write_calls() const
+ * @brief Reads the write-call counter.
+ */
+inline std::uint64_t PeriodicFileWriter::write_calls() const {
+    return write_calls_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @fn PeriodicFileWriter::fsync_calls() const
+ * @brief Reads the sync counter.
+ */
+inline std::uint64_t PeriodicFileWriter::fsync_calls() const {
+    return fsync_calls_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @fn PeriodicFileWriter::last_error() const
+ * @brief Reads the most recent error.
+ */
+inline std::error_code PeriodicFileWriter::last_error() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return last_error_;
+}
+
+/**
+ * @fn PeriodicFileWriter::uses_io_uring() const
+ * @brief Reads whether the ring is in use.
+ */
+inline bool PeriodicFileWriter::uses_io_uring() const {
+#if PERIODIC_FILE_WRITER_HAS_IO_URING
+    return uring_ready_;
+#else
+    return false;
+#endif
+}
+
+#endif // PERIODIC_FILE_WRITER_HPP
@@ -0,0 +1,400 @@
+#ifndef PERIODIC_PIPELINE_HPP
+#define PERIODIC_PIPELINE_HPP
+#include "PeriodicExecutor.hpp"
+#include <boost/asio/thread_pool.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file
+ * @brief Header file for the PeriodicPipeline class.
+ */
+
+/**
+ * @brief Untyped reference to a pipeline stage, used to declare dependencies.
+ */
+struct StageRef {
+    std::size_t id;
+    /**< @brief The stage index; stages are numbered in the order they were added. */
+};
+
+/**
+ * @brief Typed reference to a pipeline stage whose output buffer holds a `\`T\``.
+ * @tparam T The stage's output type, or `\`void\`` for a stage without output.
+ */
+template <typename T>
+struct Stage : StageRef {};
+
+/**
+ * @class PeriodicPipeline
+ * @brief Runs a DAG of stages once per period, in dependency order.
+ *
+ * @details A pipeline such as sample → filter → publish is declared as stages with
+ * explicit dependencies instead of as separate `\`PeriodicExecutor\``s with hand-tuned
+ * phase offsets. A single `\`PeriodicExecutor\`` drives the tick; each tick runs every
+ * stage after all of its dependencies have finished, and independent branches run in
+ * parallel on an internal `\`boost::asio::thread_pool\``.
+ *
+ * Each stage with an output type owns one output buffer that is constructed once when
+ * the stage is added and overwritten in place on every tick. Downstream stages read it
+ * by `\`const\`` reference through `\`input()\``, so results are handed over without
+ * copies or allocations. Because a tick completes before the next one starts, a single
+ * buffer per stage is enough.
+ *
+ * A stage that throws does not stop the tick: its successors still run on the values
+ * left in its buffer, and the exception is available from `\`last_error()\``.
+ */
+class PeriodicPipeline {
+public:
+    /**
+     * @brief Constructs an empty pipeline.
+     * @param[in] parallelism The number of pool threads used to run independent stages
+     * concurrently. With `\`1\`` all stages run on the executor's worker thread in the
+     * order they were added, which is always a valid topological order.
+     */
+    explicit PeriodicPipeline(std::size_t parallelism = 1);
+
+    /**
+     * @brief Destructor for `PeriodicPipeline`.
+     * @details Stops the tick and joins the pool threads.
+     */
+    ~PeriodicPipeline();
+
+    /**
+     * @brief Adds a stage to the pipeline.
+     *
+     * @details Must be called while the pipeline is stopped. Dependencies can only name stages that
+     * were added earlier, so the graph is acyclic by construction. For `\`T = void\`` the
+     * body takes no arguments; otherwise it receives the stage's output buffer, which
+     * still holds the previous tick's value.
+     *
+     * @tparam T The output type; default-constructed once.
+     * @tparam Fn A callable `\`void(T&)\``, or `\`void()\`` for `\`T = void\``.
+     * @param[in] body The stage body.
+     * @param[in] dependencies The stages that must finish before this one runs.
+     * @return A typed reference used with `\`input()\`` and as a dependency.
+     * @throws std::logic_error If called while running or with an unknown dependency.
+     */
+    template <typename T, typename Fn>
+    Stage<T> add_stage(Fn body, std::initializer_list<StageRef> dependencies = {});
+
+    /**
+     * @brief Reads the current output of a stage.
+     *
+     * @details Intended for stage bodies that declared `\`stage\`` as a dependency; the
+     * value is then complete for the current tick.
+     *
+     * @param[in] stage The stage to read.
+     * @return A reference to the stage's output buffer.
+     */
+    template <typename T>
+    const T& input(Stage<T> stage) const;
+
+    /**
+     * @brief Starts ticking the pipeline.
+     * @param[in] interval The period between ticks.
+     * @return `true` if the pipeline was started, `false` if it was already running.
+     */
+    bool start(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Stops ticking the pipeline after the current tick completes.
+     * @details Can be called multiple times. The pipeline may be started again afterwards;
+     * the stage outputs keep their values across the restart.
+     */
+    void stop();
+
+    /**
+     * @brief Returns the most recent exception thrown by a stage, or an empty pointer.
+     */
+    std::exception_ptr last_error() const;
+
+    // Stages hold pointers into the pipeline, so it can be neither copied nor moved.
+    PeriodicPipeline(const PeriodicPipeline&) = delete;
+    PeriodicPipeline& operator=(const PeriodicPipeline&) = delete;
+
+private:
+    /**
+     * @brief Type-erased stage node.
+     */
+    struct StageNode {
+        virtual ~StageNode() = default;
+        /**
+         * @brief Runs the stage body once.
+         */
+        virtual void run() = 0;
+
+        std::vector<std::size_t> successors;
+        /**< @brief Stages that depend on this one. */
+        std::size_t dependency_count = 0;
+        /**< @brief The number of stages this one depends on. */
+        std::atomic<std::size_t> pending{0};
+        /**< @brief Dependencies that have not finished in the current tick. */
+    };
+
+    /**
+     * @brief Stage node holding a typed output buffer; the target of `\`input()\``.
+     */
+    template <typename T>
+    struct OutputStage : StageNode {
+        T output{};
+        /**< @brief The preallocated output buffer, reused every tick. */
+    };
+
+    /**
+     * @brief Output stage together with its body.
+     */
+    template <typename T, typename Fn>
+    struct TypedStage : OutputStage<T> {
+        explicit TypedStage(Fn fn) : body(std::move(fn)) {}
+        void run() override { body(this->output); }
+        Fn body;
+        /**< @brief The stage body. */
+    };
+
+    /**
+     * @brief Stage node without output.
+     */
+    template <typename Fn>
+    struct VoidStage : StageNode {
+        explicit VoidStage(Fn fn) : body(std::move(fn)) {}
+        void run() override { body(); }
+        Fn body;
+        /**< @brief The stage body. */
+    };
+
+    /**
+     * @brief Runs all stages once; invoked by the executor on every tick.
+     *
+     * @details Blocks the executor's worker until the last stage has finished.
+     */
+    void run_tick();
+
+    /**
+     * @brief Runs one stage on the pool and releases its successors.
+     * @param[in] id The stage to run.
+     */
+    void run_stage(std::size_t id);
+
+    /**
+     * @brief Stores a stage's exception for `\`last_error()\``.
+     * @param[in] error The exception thrown by the stage.
+     */
+    void fail(std::exception_ptr error);
+
+    std::vector<std::unique_ptr<StageNode>> stages_;
+    /**< @brief All stages, indexed by `\`StageRef::id\``. */
+    std::vector<std::size_t> roots_;
+    /**< @brief Stages without dependencies, started first on every tick. */
+    std::size_t parallelism_;
+    /**< @brief The number of pool threads; `\`1\`` runs stages inline. */
+    std::unique_ptr<boost::asio::thread_pool> pool_;
+    /**< @brief Runs independent stages concurrently; only created if `\`parallelism_ > 1\``. */
+    mutable std::mutex done_mutex_;
+    /**< @brief Protects `\`remaining_\`` for the completion wait, and `\`last_error_\``. */
+    std::condition_variable done_;
+    /**< @brief Signalled when the last stage of a tick has finished. */
+    std::size_t remaining_ = 0;
+    /**< @brief Stages that have not finished in the current tick. */
+    std::exception_ptr last_error_;
+    /**< @brief The most recent exception raised by a stage. */
+    bool started_ = false;
+    /**< @brief Set by `\`start()\`` and cleared by `\`stop()\``; the graph is frozen in between. */
+    PeriodicExecutor<> executor_;
+    /**< @brief Drives the tick; declared last so it is stopped before the stages are destroyed. */
+};
+
+// PeriodicPipeline Implementation
+
+/**
+ * @fn PeriodicPipeline::PeriodicPipeline(std::size_t parallelism)
+ * @brief Constructs an empty pipeline.
+ * @param[in] parallelism The number of pool threads.
+ */
+inline PeriodicPipeline::PeriodicPipeline(std::size_t parallelism)
+    : parallelism_(parallelism == 0 ? 1 : parallelism) {
+    if (parallelism_ > 1) {
+        pool_ = std::make_unique<boost::asio::thread_pool>(parallelism_);
+    }
+}
+
+/**
+ * @fn PeriodicPipeline::~PeriodicPipeline()
+ * @brief Stops the tick and joins the pool.
+ */
+inline PeriodicPipeline::~PeriodicPipeline() {
+    stop();
+    if (pool_) {
+        pool_->join();
+    }
+}
+
+/**
+ * @fn PeriodicPipeline::add_stage(Fn body, std::initializer_list<StageRef> dependencies)
+ * @brief Adds a stage and links it to its dependencies.
+ *
+ * @details The output buffer is allocated here, once, as part of the stage node.
+ * @param[in] body The stage body.
+ * @param[in] dependencies The stages that must finish first.
+ * @return A typed reference to the new stage.
+ */
+template <typename T, typename Fn>
+Stage<T> PeriodicPipeline::add_stage(Fn body, std::initializer_list<StageRef> dependencies) {
+    if (started_) {
+        throw std::logic_error("PeriodicPipeline: stages must be added while the pipeline is stopped");
+    }
+    const std::size_t id = stages_.size();
+    std::unique_ptr<StageNode> node;
+    if constexpr (std::is_void<T>::value) {
+        node = std::make_unique<VoidStage<Fn>>(std::move(body));
+    } else {
+        node = std::make_unique<TypedStage<T, Fn>>(std::move(body));
+    }
+    for (const StageRef& dependency : dependencies) {
+        if (dependency.id >= id) {
+            throw std::logic_error("PeriodicPipeline: unknown dependency");
+        }
+        stages_[dependency.id]->successors.push_back(id);
+    }
+    node->dependency_count = dependencies.size();
+    if (dependencies.size() == 0) {
+        roots_.push_back(id);
+    }
+    stages_.push_back(std::move(node));
+
+    Stage<T> stage;
+    stage.id = id;
+    return stage;
+}
+
+/**
+ * @fn PeriodicPipeline::input(Stage<T> stage) const
+ * @brief Reads the output buffer of a stage.
+ *
+ * @details The typed handle guarantees that the node derives from `\`OutputStage<T>\``.
+ * @param[in] stage The stage to read.
+ * @return A reference to the stage's output buffer.
+ */
+template <typename T>
+const T& PeriodicPipeline::input(Stage<T> stage) const {
+    return static_cast<const OutputStage<T>*>(stages_[stage.id].get())->output;
+}
+
+/**
+ * @fn PeriodicPipeline::start(std::chrono::milliseconds interval)
+ * @brief Freezes the graph and starts the executor that drives the tick.
+ * @param[in] interval The period between ticks.
+ * @return `true` if started; `false` if already running.
+ */
+inline bool PeriodicPipeline::start(std::chrono::milliseconds interval) {
+    if (started_) {
+        return false;
+    }
+    started_ = true;
+    return executor_.start(interval, [this]() { run_tick(); });
+}
+
+/**
+ * @fn PeriodicPipeline::stop()
+ * @brief Stops the executor; a tick in progress completes first.
+ *
+ * @details With the worker joined no tick is in flight, so the graph is unfrozen and
+ * `\`start()\`` may be called again.
+ */
+inline void PeriodicPipeline::stop() {
+    executor_.stop();
+    started_ = false;
+}
+
+/**
+ * @fn PeriodicPipeline::run_tick()
+ * @brief Runs all stages once.
+ *
+ * @details Without a pool the stages run inline in index order. With a pool, every
+ * stage's pending counter is reset to its number of dependencies, the roots are posted,
+ * and each finishing stage posts the successors whose counter reaches zero. The atomic
+ * decrement orders a stage's writes to its buffer before its successors read them.
+ * Stage exceptions are caught and stored, so the executor keeps ticking.
+ */
+inline void PeriodicPipeline::run_tick() {
+    if (!pool_) {
+        for (auto& stage : stages_) {
+            try {
+                stage->run();
+            } catch (...) {
+                fail(std::current_exception());
+            }
+        }
+        return;
+    }
+
+    for (auto& stage : stages_) {
+        stage->pending.store(stage->dependency_count, std::memory_order_relaxed);
+    }
+    {
+        std::lock_guard<std::mutex> lock(done_mutex_);
+        remaining_ = stages_.size();
+    }
+    for (std::size_t id : roots_) {
+        boost::asio::post(*pool_, [this, id]() { run_stage(id); });
+    }
+
+    std::unique_lock<std::mutex> lock(done_mutex_);
+    done_.wait(lock, [this]() { return remaining_ == 0; });
+}
+
+/**
+ * @fn PeriodicPipeline::run_stage(std::size_t id)
+ * @brief Runs one stage and releases its successors.
+ *
+ * @details A failing stage still releases its successors, so the tick always
+ * completes; the error is stored for `\`last_error()\``.
+ * @param[in] id The stage to run.
+ */
+inline void PeriodicPipeline::run_stage(std::size_t id) {
+    StageNode& stage = *stages_[id];
+    try {
+        stage.run();
+    } catch (...) {
+        fail(std::current_exception());
+    }
+    for (std::size_t successor : stage.successors) {
+        if (stages_[successor]->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            boost::asio::post(*pool_, [this, successor]() { run_stage(successor); });
+        }
+    }
+    std::lock_guard<std::mutex> lock(done_mutex_);
+    if (--remaining_ == 0) {
+        done_.notify_one();
+    }
+}
+
+/**
+ * @fn PeriodicPipeline::fail(std::exception_ptr error)
+ * @brief Stores the error for `\`last_error()\``.
+ */
+inline void PeriodicPipeline::fail(std::exception_ptr error) {
+    std::lock_guard<std::mutex> lock(done_mutex_);
+    last_error_ = std::move(error);
+}
+
+/**
+ * @fn PeriodicPipeline::last_error() const
+ * @brief Reads the most recent stage exception.
+ */
+inline std::exception_ptr PeriodicPipeline::last_error() const {
+    std::lock_guard<std::mutex> lock(done_mutex_);
+    return last_error_;
+}
+
+#endif // PERIODIC_PIPELINE_HPP
@@ -0,0 +1,216 @@
+#ifndef PERIODIC_PUBLISHER_HPP
+#define PERIODIC_PUBLISHER_HPP
+#include "PeriodicExecutor.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file
+ * @brief Header file for the PeriodicPublisher class.
+ */
+
+/**
+ * @class PeriodicPublisher
+ * @brief Recomputes a value every interval and publishes it to lock-free readers.
+ *
+ * @details Config and health snapshots are commonly shared through a `\`shared_ptr\``
+ * swapped under a mutex, which puts a lock and two reference-count updates on every
+ * read. Here the executor's worker is the only writer and publishes each new value
+ * under a sequence lock: the sequence number is odd while the value is being copied
+ * in and is advanced to the next even number afterwards. Readers copy the value and
+ * retry if the sequence number was odd or changed meanwhile. A read therefore takes
+ * no lock, performs no atomic read-modify-write and allocates nothing, and readers
+ * never write shared memory, so any number of them scale without contention.
+ *
+ * The value is recomputed into a private buffer first, so the window during which
+ * readers have to retry is one copy of `\`T\``, independent of the compute time.
+ *
+ * @tparam T The snapshot type; it must be trivially copyable.
+ */
+template <typename T>
+class PeriodicPublisher {
+    static_assert(std::is_trivially_copyable<T>::value, "PeriodicPublisher values must be trivially copyable");
+
+public:
+    /**
+     * @brief Constructs a stopped publisher that publishes `\`initial\`` until the first tick.
+     * @param[in] compute Recomputes the value in place; it receives the previous value.
+     * @param[in] initial The value visible to readers before the first tick.
+     */
+    explicit PeriodicPublisher(std::function<void(T&)> compute, const T& initial = T{});
+
+    /**
+     * @brief Starts recomputing the value.
+     * @param[in] interval The period between recomputations.
+     * @return `true` if started, `false` if already running.
+     */
+    bool start(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Stops recomputing; the last published value stays readable.
+     */
+    void stop();
+
+    /**
+     * @brief Returns the latest published value.
+     * @details Wait-free for the writer and lock-free for readers; safe from any thread.
+     */
+    T latest() const;
+
+    /**
+     * @brief Copies the latest value only if it is newer than `\`seen\``.
+     *
+     * @details Lets a reader that polls in a loop skip the copy when nothing changed.
+     *
+     * @param[out] out Receives the value if it is newer.
+     * @param[in,out] seen The version the caller has; updated to the version read.
+     * @return `true` if `\`out\`` was updated.
+     */
+    bool read_if_newer(T& out, std::uint64_t& seen) const;
+
+    /**
+     * @brief Returns the number of values published since construction.
+     */
+    std::uint64_t version() const;
+
+private:
+    /**
+     * @brief Publishes `\`scratch_\`` under the sequence lock. Runs on the worker.
+     */
+    void publish();
+
+    /**
+     * @brief Reads a consistent copy of the value.
+     * @param[out] out Receives the value.
+     * @return The even sequence number the copy belongs to.
+     */
+    std::uint64_t read(T& out) const;
+
+    static constexpr std::size_t cache_line = 64;
+    /**< @brief The assumed cache-line size; the shared state gets its own lines. */
+
+    std::function<void(T&)> compute_;
+    /**< @brief The user-supplied recomputation. */
+    T scratch_;
+    /**< @brief Worker only: the value being recomputed. */
+    alignas(cache_line) std::atomic<std::uint64_t> sequence_{0};
+    /**< @brief Odd while `\`value_\`` is being written; twice the version otherwise. */
+    T value_;
+    /**< @brief The published value. */
+    alignas(cache_line) PeriodicExecutor<> executor_;
+    /**< @brief Drives the recomputation; declared last so it stops before the value goes away,
+     * and aligned so its per-tick writes do not share a cache line with `\`value_\``. */
+};
+
+// PeriodicPublisher Implementation
+
+/**
+ * @fn PeriodicPublisher::PeriodicPublisher(std::function<void(T&)> compute, const T& initial)
+ * @brief Constructs a stopped publisher.
+ */
+template <typename T>
+PeriodicPublisher<T>::PeriodicPublisher(std::function<void(T&)> compute, const T& initial)
+    : compute_(std::move(compute)), scratch_(initial), value_(initial) {}
+
+/**
+ * @fn PeriodicPublisher::start(std::chrono::milliseconds interval)
+ * @brief Starts the executor; each tick recomputes and publishes.
+ */
+template <typename T>
+bool PeriodicPublisher<T>::start(std::chrono::milliseconds interval) {
+    return executor_.start(interval, [this]() {
+        compute_(scratch_);
+        publish();
+    });
+}
+
+/**
+ * @fn PeriodicPublisher::stop()
+ * @brief Stops the executor.
+ */
+template <typename T>
+void PeriodicPublisher<T>::stop() {
+    executor_.stop();
+}
+
+/**
+ * @fn PeriodicPublisher::publish()
+ * @brief The sequence-lock write side.
+ *
+ * @details There is a single writer, so the sequence number is advanced with plain
+ * loads and stores. The release fence keeps the copy from being reordered before the
+ * odd sequence number; the final release store publishes the copy.
+ */
+template <typename T>
+void PeriodicPublisher<T>::publish() {
+    const std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    value_ = scratch_;
+    sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+/**
+ * @fn PeriodicPublisher::read(T& out) const
+ * @brief The sequence-lock read side.
+ *
+ * @details Retries while a write is in progress or completed during the copy. The
+ * acquire fence keeps the copy from being reordered after the second load.
+ */
+template <typename T>
+std::uint64_t PeriodicPublisher<T>::read(T& out) const {
+    for (;;) {
+        const std::uint64_t before = sequence_.load(std::memory_order_acquire);
+        if ((before & 1) != 0) {
+            continue;
+        }
+        out = value_;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) == before) {
+            return before;
+        }
+    }
+}
+
+/**
+ * @fn PeriodicPublisher::latest() const
+ * @brief Returns a consistent copy of the latest value.
+ */
+template <typename T>
+T PeriodicPublisher<T>::latest() const {
+    T out;
+    read(out);
+    return out;
+}
+
+/**
+ * @fn PeriodicPublisher::read_if_newer(T& out, std::uint64_t& seen) const
+ * @brief Copies the value only if its version differs from `\`seen\``.
+ *
+ * @details The version check is a single acquire load, so an unchanged value costs
+ * no copy.
+ */
+template <typename T>
+bool PeriodicPublisher<T>::read_if_newer(T& out, std::uint64_t& seen) const {
+    if (sequence_.load(std::memory_order_acquire) == 2 * seen) {
+        return false;
+    }
+    seen = read(out) / 2;
+    return true;
+}
+
+/**
+ * @fn PeriodicPublisher::version() const
+ * @brief Returns the number of completed publications.
+ */
+template <typename T>
+std::uint64_t PeriodicPublisher<T>::version() const {
+    return sequence_.load(std::memory_order_acquire) / 2;
+}
+
+#endif // PERIODIC_PUBLISHER_HPP
@@ -0,0 +1,393 @@
+#ifndef PERIODIC_SAMPLER_HPP
+#define PERIODIC_SAMPLER_HPP
+#include "PeriodicExecutor.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file
+ * @brief Header file for the SampleRing and PeriodicSampler classes.
+ */
+
+/**
+ * @brief Selects what a full `\`SampleRing\`` does with a new sample.
+ */
+enum class OverflowPolicy {
+    Drop,     /**< @brief Reject the new sample; the consumer sees every sample it has not yet read. */
+    Overwrite /**< @brief Replace the oldest unread sample; the consumer always sees the newest data. */
+};
+
+/**
+ * @brief Selects whether a `\`SampleRing\`` accepts one or several concurrent producers.
+ */
+enum class ProducerMode {
+    Single, /**< @brief Exactly one producer thread; a push is a handful of plain stores. */
+    Multi   /**< @brief Any number of producer threads; slots are claimed with atomic read-modify-write. */
+};
+
+/**
+ * @class SampleRing
+ * @brief A preallocated lock-free ring buffer of fixed-size records with one consumer.
+ *
+ * @details Replaces the mutex-protected deque between a periodic sampler and its consumer
+ * thread. Every slot carries a sequence number that encodes which position it holds and
+ * whether it is being written (`\`2*pos+1\``) or complete (`\`2*pos+2\``). The consumer
+ * copies a slot and re-checks its sequence number, so it never returns a record that a
+ * producer overwrote while it was being read, and it detects and skips over samples it
+ * has lost to `\`OverflowPolicy::Overwrite\``.
+ *
+ * The write index and the read index live on separate cache lines, so producers and the
+ * consumer do not invalidate each other's line on every operation. A single producer
+ * under `\`OverflowPolicy::Drop\`` additionally caches the consumer's index and only reloads
+ * it when the ring looks full.
+ *
+ * @tparam T The record type; it must be trivially copyable.
+ * @tparam Mode Whether one or several threads call `\`push()\``.
+ */
+template <typename T, ProducerMode Mode = ProducerMode::Single>
+class SampleRing {
+    static_assert(std::is_trivially_copyable<T>::value, "SampleRing records must be trivially copyable");
+
+public:
+    /**
+     * @brief Constructs an empty ring.
+     * @param[in] capacity The minimum number of records; rounded up to a power of two.
+     * @param[in] policy What to do when the ring is full.
+     */
+    SampleRing(std::size_t capacity, OverflowPolicy policy);
+
+    /**
+     * @brief Appends a record.
+     * @param[in] sample The record to append.
+     * @return `false` if the record was dropped because the ring is full.
+     */
+    bool push(const T& sample);
+
+    /**
+     * @brief Moves up to `\`max\`` records, oldest first, into `\`out\``.
+     *
+     * @details Must only be called by the single consumer thread. Records lost to
+     * overwriting are skipped and counted in `\`overwritten()\``.
+     *
+     * @param[out] out Receives the records.
+     * @param[in] max The capacity of `\`out\``.
+     * @return The number of records written to `\`out\``.
+     */
+    std::size_t pop_batch(T* out, std::size_t max);
+
+    /**
+     * @brief Returns the number of records, always a power of two.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Returns the number of records rejected under `\`OverflowPolicy::Drop\``.
+     */
+    std::uint64_t dropped() const;
+
+    /**
+     * @brief Returns the number of records overwritten before the consumer read them.
+     */
+    std::uint64_t overwritten() const;
+
+    // The ring is shared by reference between producers and the consumer.
+    SampleRing(const SampleRing&) = delete;
+    SampleRing& operator=(const SampleRing&) = delete;
+
+private:
+    /**
+     * @brief One record together with its sequence number.
+     */
+    struct Slot {
+        std::atomic<std::uint64_t> sequence{0};
+        /**< @brief `\`2*pos+1\`` while position `\`pos\`` is written, `\`2*pos+2\`` once it is complete. */
+        T value;
+        /**< @brief The record. */
+    };
+
+    /**
+     * @brief Claims the next write position.
+     * @param[out] position The claimed position.
+     * @return `false` if the record must be dropped.
+     */
+    bool claim(std::uint64_t& position);
+
+    static constexpr std::size_t cache_line = 64;
+    /**< @brief The assumed cache-line size used to separate the indices. */
+
+    std::size_t mask_;
+    /**< @brief `\`capacity - 1\``; maps positions to slots. */
+    OverflowPolicy policy_;
+    /**< @brief What to do when the ring is full. */
+    std::unique_ptr<Slot[]> slots_;
+    /**< @brief The preallocated records. */
+    alignas(cache_line) std::atomic<std::uint64_t> head_{0};
+    /**< @brief The next position to be claimed by a producer. */
+    std::uint64_t cached_tail_ = 0;
+    /**< @brief Single producer only: the last value of `\`tail_\`` the producer has seen. */
+    std::atomic<std::uint64_t> dropped_{0};
+    /**< @brief Records rejected by `\`push()\``. */
+    alignas(cache_line) std::atomic<std::uint64_t> tail_{0};
+    /**< @brief The next position the consumer will read; published for dropping producers. */
+    std::atomic<std::uint64_t> overwritten_{0};
+    /**< @brief Records the consumer skipped because they were overwritten. */
+};
+
+/**
+ * @class PeriodicSampler
+ * @brief A periodic task that writes one record per tick into a `\`SampleRing\``.
+ *
+ * @details The sample function fills a record in place on the executor's worker thread,
+ * so taking a sample allocates nothing. Several samplers can feed the same ring if it
+ * was created with `\`ProducerMode::Multi\``. Consumers read with `\`SampleRing::pop_batch()\``
+ * at their own pace.
+ *
+ * @tparam T The record type.
+ * @tparam Mode The producer mode of the target ring.
+ */
+template <typename T, ProducerMode Mode = ProducerMode::Single>
+class PeriodicSampler {
+public:
+    /**
+     * @brief Constructs a stopped sampler.
+     * @param[in] ring The ring to write to; it must outlive the sampler.
+     * @param[in] sample Fills a record; called once per tick.
+     */
+    PeriodicSampler(SampleRing<T, Mode>& ring, std::function<void(T&)> sample);
+
+    /**
+     * @brief Starts sampling.
+     * @param[in] interval The sampling period.
+     * @return `true` if started, `false` if already running.
+     */
+    bool start(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Stops sampling.
+     */
+    void stop();
+
+private:
+    SampleRing<T, Mode>& ring_;
+    /**< @brief The ring receiving the samples. */
+    std::function<void(T&)> sample_;
+    /**< @brief The user-supplied sample function. */
+    PeriodicExecutor<> executor_;
+    /**< @brief Drives the sampling; declared last so it stops before the members above go away. */
+};
+
+// SampleRing Implementation
+
+/**
+ * @fn SampleRing::SampleRing(std::size_t capacity, OverflowPolicy policy)
+ * @brief Allocates all slots up front.
+ * @param[in] capacity The minimum number of records.
+ * @param[in] policy What to do when the ring is full.
+ */
+template <typename T, ProducerMode Mode>
+SampleRing<T, Mode>::SampleRing(std::size_t capacity, OverflowPolicy policy) : policy_(policy) {
+    std::size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    mask_ = size - 1;
+    slots_.reset(new Slot[size]);
+}
+
+/**
+ * @fn SampleRing::claim(std::uint64_t& position)
+ * @brief Claims a write position.
+ *
+ * @details Under `\`OverflowPolicy::Overwrite\`` positions are handed out unconditionally.
+ * Under `\`OverflowPolicy::Drop\`` a position is only claimed while fewer than capacity
+ * records are unread; with several producers the check and the claim are one
+ * compare-and-swap on `\`head_\``. `\`tail_\`` only grows, so a stale read of it can only
+ * cause a spurious drop, never an overrun.
+ * @param[out] position The claimed position.
+ * @return `false` if the record must be dropped.
+ */
+template <typename T, ProducerMode Mode>
+bool SampleRing<T, Mode>::claim(std::uint64_t& position) {
+    const std::uint64_t capacity = mask_ + 1;
+    if (Mode == ProducerMode::Single) {
+        position = head_.load(std::memory_order_relaxed);
+        if (policy_ == OverflowPolicy::Drop && position - cached_tail_ >= capacity) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (position - cached_tail_ >= capacity) {
+                return false;
+            }
+        }
+        head_.store(position + 1, std::memory_order_relaxed);
+        return true;
+    }
+    if (policy_ == OverflowPolicy::Overwrite) {
+        position = head_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    position = head_.load(std::memory_order_relaxed);
+    do {
+        if (position - tail_.load(std::memory_order_acquire) >= capacity) {
+            return false;
+        }
+    } while (!head_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed));
+    return true;
+}
+
+/**
+ * @fn SampleRing::push(const T& sample)
+ * @brief Writes a record under the slot's sequence lock.
+ *
+ * @details The slot is marked as being written, the record is copied and the slot is
+ * published with release order. With several producers under overwriting, two
+ * producers a full lap apart can target the same slot; the mark is then taken with
+ * a compare-and-swap, and a producer that finds the slot already claimed for a later
+ * lap discards its record as overwritten.
+ * @param[in] sample The record to append.
+ * @return `false` if the record was dropped.
+ */
+template <typename T, ProducerMode Mode>
+bool SampleRing<T, Mode>::push(const T& sample) {
+    std::uint64_t position;
+    if (!claim(position)) {
+        if (Mode == ProducerMode::Single) {
+            dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        } else {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return false;
+    }
+    Slot& slot = slots_[position & mask_];
+    const std::uint64_t writing = 2 * position + 1;
+    if (Mode == ProducerMode::Multi && policy_ == OverflowPolicy::Overwrite) {
+        std::uint64_t current = slot.sequence.load(std::memory_order_relaxed);
+        for (;;) {
+            if (current >= writing) {
+                overwritten_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            if ((current & 1) != 0) {
+                current = slot.sequence.load(std::memory_order_relaxed); // an older lap is still writing
+            } else if (slot.sequence.compare_exchange_weak(current, writing, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+    } else {
+        slot.sequence.store(writing, std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.value = sample;
+    slot.sequence.store(writing + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @fn SampleRing::pop_batch(T* out, std::size_t max)
+ * @brief Reads records in order until `\`max\`` is reached or the next one is not complete.
+ *
+ * @details A slot whose sequence number is below `\`2*pos+2\`` has not been completed for
+ * the current position and ends the batch. A higher sequence number means producers
+ * have lapped the consumer; it then skips to the oldest position that can still be
+ * in the ring. The record is copied before the sequence number is re-checked, which
+ * discards copies torn by a concurrent overwrite.
+ * @param[out] out Receives the records.
+ * @param[in] max The capacity of `\`out\``.
+ * @return The number of records read.
+ */
+template <typename T, ProducerMode Mode>
+std::size_t SampleRing<T, Mode>::pop_batch(T* out, std::size_t max) {
+    const std::uint64_t capacity = mask_ + 1;
+    std::uint64_t position = tail_.load(std::memory_order_relaxed);
+    std::size_t count = 0;
+    while (count < max) {
+        Slot& slot = slots_[position & mask_];
+        const std::uint64_t complete = 2 * position + 2;
+        const std::uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before < complete) {
+            break;
+        }
+        if (before == complete) {
+            out[count] = slot.value;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == complete) {
+                ++count;
+                ++position;
+                continue;
+            }
+        }
+        // Lapped: resume at the oldest position that can still be in the ring.
+        const std::uint64_t head = head_.load(std::memory_order_acquire);
+        const std::uint64_t oldest = head > capacity ? head - capacity : 0;
+        const std::uint64_t resume = oldest > position ? oldest : position + 1;
+        overwritten_.fetch_add(resume - position, std::memory_order_relaxed);
+        position = resume;
+    }
+    tail_.store(position, std::memory_order_release);
+    return count;
+}
+
+/**
+ * @fn SampleRing::capacity() const
+ * @brief Returns the number of slots.
+ */
+template <typename T, ProducerMode Mode>
+std::size_t SampleRing<T, Mode>::capacity() const {
+    return mask_ + 1;
+}
+
+/**
+ * @fn SampleRing::dropped() const
+ * @brief Reads the drop counter.
+ */
+template <typename T, ProducerMode Mode>
+std::uint64_t SampleRing<T, Mode>::dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @fn SampleRing::overwritten() const
+ * @brief Reads the overwrite counter.
+ */
+template <typename T, ProducerMode Mode>
+std::uint64_t SampleRing<T, Mode>::overwritten() const {
+    return overwritten_.load(std::memory_order_relaxed);
+}
+
+// PeriodicSampler Implementation
+
+/**
+ * @fn PeriodicSampler::PeriodicSampler(SampleRing<T, Mode>& ring, std::function<void(T&)> sample)
+ * @brief Constructs a stopped sampler.
+ */
+template <typename T, ProducerMode Mode>
+PeriodicSampler<T, Mode>::PeriodicSampler(SampleRing<T, Mode>& ring, std::function<void(T&)> sample)
+    : ring_(ring), sample_(std::move(sample)) {}
+
+/**
+ * @fn PeriodicSampler::start(std::chrono::milliseconds interval)
+ * @brief Starts the executor; each tick fills a stack record and pushes it.
+ */
+template <typename T, ProducerMode Mode>
+bool PeriodicSampler<T, Mode>::start(std::chrono::milliseconds interval) {
+    return executor_.start(interval, [this]() {
+        T record{};
+        sample_(record);
+        ring_.push(record);
+    });
+}
+
+/**
+ * @fn PeriodicSampler::stop()
+ * @brief Stops the executor.
+ */
+template <typename T, ProducerMode Mode>
+void PeriodicSampler<T, Mode>::stop() {
+    executor_.stop();
+}
+
+#endif // PERIODIC_SAMPLER_HPP
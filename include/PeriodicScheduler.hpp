@@ -0,0 +1,1162 @@
+#ifndef PERIODIC_SCHEDULER_HPP
+#define PERIODIC_SCHEDULER_HPP
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include "CronSchedule.hpp"
+#include "TaskPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file
+ * @brief Header file for the PeriodicScheduler class.
+ */
+
+/**
+ * @brief Selects how the `\`PeriodicScheduler\`` ranks tasks that are due in the same wakeup.
+ */
+enum class PriorityPolicy {
+    Explicit,     /**< @brief Use the priority passed to `\`add_task()\``; higher values run first. */
+    RateMonotonic, /**< @brief Shorter periods run first; the explicit priority is ignored. */
+    EarliestDeadlineFirst /**< @brief Ready jobs run strictly by absolute deadline; see `\`post_at()\``. */
+};
+
+/**
+ * @class PeriodicScheduler
+ * @brief Multiplexes many periodic tasks onto a single timer and worker thread.
+ *
+ * @details Where a `\`PeriodicExecutor\`` owns one `\`io_context\``, one `\`steady_timer\``
+ * and one thread per task, the `\`PeriodicScheduler\`` keeps all task deadlines in a
+ * min-heap and arms one `\`steady_timer\`` for the earliest of them. When the timer
+ * expires, every task whose deadline has passed is collected and dispatched in
+ * priority order, so a control-loop task runs before a housekeeping task that became
+ * due in the same wakeup. Each task is re-armed relative to its previous deadline,
+ * giving the same anti-drift behaviour as `\`PeriodicExecutor\``.
+ *
+ * Under `\`PriorityPolicy::EarliestDeadlineFirst\`` the scheduler keeps a second heap of
+ * ready jobs ordered by absolute deadline. A periodic task is released at each tick
+ * with the next tick as its deadline, while one-shot jobs from `\`post_at()\`` are ready
+ * at once. The worker runs one ready job at a time, earliest deadline first, so
+ * deferrable one-shot work fills the idle time between periodic ticks.
+ *
+ * Calendar tasks registered with `\`add_cron_task()\`` share the same queue. Their next
+ * release is computed with `\`CronSchedule::next()\``, which is constant-time, so
+ * re-arming a cron task costs the same as re-arming an interval task.
+ *
+ * Task nodes and the operations that carry control calls to the worker are allocated
+ * from `\`TaskPool\``, whose per-thread caches serve steady add/remove churn without
+ * touching the global heap; stale run-queue entries are purged before the queue would
+ * grow. Callbacks are moved, never copied, so a callable small enough for
+ * `\`std::function\``'s inline buffer is never allocated. A larger callable is still
+ * placed on the global heap by `\`std::function\`` itself, on the caller's thread,
+ * before the scheduler sees it; the pool cannot serve that allocation.
+ *
+ * Cancellable tasks get a `\`TaskHandle\``, a slot in a table of generation counters
+ * and the slot's generation. `\`cancel()\`` is one compare-and-swap on that counter,
+ * so handles carry no reference count. Slots are taken from and returned to a
+ * lock-free free list; the table grows in segments that never move.
+ *
+ * All scheduler state is owned by the worker thread. The public control functions
+ * post their work to the internal `\`io_context\``, which is run by that single thread
+ * and therefore serializes them with the dispatch loop without a `\`strand\``.
+ */
+class PeriodicScheduler {
+public:
+    /**
+     * @brief The clock used for all task deadlines.
+     */
+    using clock_type = boost::asio::steady_timer::clock_type;
+
+    /**
+     * @brief Identifies a task registered with `\`add_task()\``.
+     */
+    using TaskId = std::uint64_t;
+
+    /**
+     * @brief Cancellation handle for a task added with `\`schedule_after()\``,
+     * `\`add_bounded_task()\`` or `\`add_task_until()\``.
+     *
+     * @details A handle is a slot in the scheduler's handle table and the generation the
+     * slot had when the task was registered; it is 8 bytes and trivially copyable. The
+     * slot's generation advances when the task is cancelled or finishes, so a stale handle
+     * is recognised with one comparison, even after its slot has been reused. A
+     * default-constructed handle refers to no task.
+     */
+    struct TaskHandle {
+        std::uint32_t slot = 0xFFFFFFFFu;
+        /**< @brief The handle-table slot; `\`0xFFFFFFFF\`` for an empty handle. */
+        std::uint32_t generation = 0;
+        /**< @brief The slot generation the task was registered in. */
+
+        /**
+         * @brief Reports whether the handle was returned for a registered task.
+         */
+        bool valid() const { return slot != 0xFFFFFFFFu; }
+    };
+
+    /**
+     * @brief Constructs a new `PeriodicScheduler` instance.
+     * @param[in] policy How simultaneously-due tasks are ordered.
+     */
+    explicit PeriodicScheduler(PriorityPolicy policy = PriorityPolicy::Explicit);
+
+    /**
+     * @brief Destructor for `PeriodicScheduler`.
+     * @details Calls `\`stop()\`` to join the worker thread before the object is destroyed.
+     */
+    ~PeriodicScheduler();
+
+    /**
+     * @brief Starts the worker thread that dispatches the registered tasks.
+     *
+     * @details Tasks added before `\`start()\`` share a common anchor, so tasks with the
+     * same period become due in the same wakeup. This function can only be called once.
+     *
+     * @return `true` if the scheduler was started, `false` if it was already running.
+     */
+    bool start();
+
+    /**
+     * @brief Stops dispatching and safely joins the worker thread.
+     * @details Can be called multiple times.
+     */
+    void stop();
+
+    /**
+     * @brief Registers a periodic task.
+     *
+     * @details Safe to call from any thread, including from within a task callback.
+     * The first execution is due one `\`interval\`` after `\`start()\`` for tasks added
+     * before the scheduler runs, and one `\`interval\`` after this call otherwise.
+     *
+     * @param[in] interval The time interval (duration) between task executions.
+     * @param[in] callback The function to be executed periodically.
+     * @param[in] priority The task priority for `\`PriorityPolicy::Explicit\``; higher
+     * values are dispatched first.
+     * @return The identifier of the new task, used with `\`remove_task()\``.
+     */
+    TaskId add_task(std::chrono::milliseconds interval, std::function<void()> callback, int priority = 0);
+
+    /**
+     * @brief Submits a one-shot job with an absolute deadline.
+     *
+     * @details Safe to call from any thread. Under `\`PriorityPolicy::EarliestDeadlineFirst\``
+     * the job is ready immediately and competes with released periodic ticks by deadline.
+     * Under the priority policies deadlines carry no ordering information, so the job is
+     * simply dispatched when `\`deadline\`` is reached; with `\`PriorityPolicy::RateMonotonic\``
+     * it has no period and ranks below every periodic task.
+     *
+     * @param[in] deadline The absolute time by which the job should have run.
+     * @param[in] callback The function to be executed once.
+     * @param[in] priority The job priority for `\`PriorityPolicy::Explicit\``.
+     * @return The identifier of the job; it can be withdrawn with `\`remove_task()\``.
+     */
+    TaskId post_at(clock_type::time_point deadline, std::function<void()> callback, int priority = 0);
+
+    /**
+     * @brief Submits a one-shot job that runs after a delay.
+     *
+     * @details Safe to call from any thread. Equivalent to `\`post_at(now + delay, ...)\``,
+     * but returns a handle that cancels the job without a round trip to the worker.
+     *
+     * @param[in] delay The time from now until the job runs.
+     * @param[in] callback The function to be executed once.
+     * @param[in] priority The job priority for `\`PriorityPolicy::Explicit\``.
+     * @return A handle that cancels the job.
+     */
+    TaskHandle schedule_after(std::chrono::milliseconds delay, std::function<void()> callback, int priority = 0);
+
+    /**
+     * @brief Registers a periodic task that runs exactly `\`runs\`` times.
+     *
+     * @details Safe to call from any thread. The first execution is due as described for
+     * `\`add_task()\``; after the last one the task is erased and its callback released.
+     *
+     * @param[in] interval The time interval (duration) between task executions.
+     * @param[in] runs The number of executions; `\`0\`` means unbounded.
+     * @param[in] callback The function to be executed periodically.
+     * @param[in] priority The task priority for `\`PriorityPolicy::Explicit\``.
+     * @return A handle that cancels the remaining executions.
+     */
+    TaskHandle add_bounded_task(std::chrono::milliseconds interval, std::size_t runs,
+                                std::function<void()> callback, int priority = 0);
+
+    /**
+     * @brief Registers a periodic task whose executions end at an absolute time.
+     *
+     * @details Safe to call from any thread. Releases later than `\`until\`` are not
+     * executed; the task is erased and its callback released after the last one.
+     *
+     * @param[in] interval The time interval (duration) between task executions.
+     * @param[in] until The last time at which a release may lie.
+     * @param[in] callback The function to be executed periodically.
+     * @param[in] priority The task priority for `\`PriorityPolicy::Explicit\``.
+     * @return A handle that cancels the remaining executions.
+     */
+    TaskHandle add_task_until(std::chrono::milliseconds interval, clock_type::time_point until,
+                              std::function<void()> callback, int priority = 0);
+
+    /**
+     * @brief Registers a task that fires according to a calendar schedule.
+     *
+     * @details Safe to call from any thread. After each execution the next fire time
+     * is looked up from the current wall-clock time and converted to a
+     * `\`steady_timer\`` deadline, so the task follows wall-clock adjustments. A schedule
+     * may be shared by any number of tasks. Under `\`PriorityPolicy::RateMonotonic\``
+     * cron tasks have no fixed period and rank below every interval task; under EDF
+     * each release has the following fire time as its deadline.
+     *
+     * @param[in] schedule The calendar schedule.
+     * @param[in] callback The function to execute at each fire time.
+     * @param[in] priority The task priority for `\`PriorityPolicy::Explicit\``.
+     * @return The identifier of the new task, used with `\`remove_task()\``.
+     */
+    TaskId add_cron_task(std::shared_ptr<const CronSchedule> schedule, std::function<void()> callback,
+                         int priority = 0);
+
+    /**
+     * @brief Unregisters a periodic task.
+     *
+     * @details Safe to call from any thread. The task will not be dispatched after the
+     * removal has been processed by the worker thread; a callback that is already
+     * running completes normally. Unknown identifiers are ignored.
+     *
+     * @param[in] id The identifier returned by `\`add_task()\``.
+     */
+    void remove_task(TaskId id);
+
+    /**
+     * @brief Prevents all further executions of a task.
+     *
+     * @details Advances the slot's generation with one compare-and-swap, so it is O(1),
+     * lock-free and safe from any thread, including from the task's own callback. The
+     * worker drops a cancelled task when its queue entry comes up. An execution that is
+     * already running completes normally.
+     *
+     * @param[in] handle A handle returned by this scheduler.
+     * @return `true` if this call cancelled the task; `false` if the handle is empty or
+     * the task was already cancelled or finished.
+     */
+    bool cancel(TaskHandle handle);
+
+    /**
+     * @brief Reports whether a task is still registered, i.e. neither cancelled nor finished.
+     * @param[in] handle A handle returned by this scheduler.
+     */
+    bool active(TaskHandle handle) const;
+
+    /**
+     * @brief Enables preempt-by-deferral for lower-priority tasks.
+     *
+     * @details When a task is due but a higher-priority task will become due within
+     * `\`window\``, the lower-priority task is postponed until that deadline and then
+     * dispatched after the higher-priority one. A zero window (the default) disables
+     * deferral.
+     *
+     * @param[in] window How far ahead the dispatcher looks for imminent higher-priority deadlines.
+     */
+    void set_deferral_window(std::chrono::microseconds window);
+
+    // Prevent copying and copy-assignment to maintain control over the single
+    // worker thread and `io_context` instance.
+    PeriodicScheduler(const PeriodicScheduler&) = delete;
+    PeriodicScheduler& operator=(const PeriodicScheduler&) = delete;
+
+private:
+    /**
+     * @brief A registered periodic task.
+     */
+    struct Task {
+        std::chrono::milliseconds interval;
+        /**< @brief The desired period between executions. */
+        std::function<void()> callback;
+        /**< @brief The user-supplied periodic task. */
+        long long rank;
+        /**< @brief The effective priority under the scheduler's `\`PriorityPolicy\``. */
+        bool one_shot;
+        /**< @brief `true` for jobs from `\`post_at()\``, which are erased after running once. */
+        std::shared_ptr<const CronSchedule> cron;
+        /**< @brief The calendar schedule of a cron task; empty for interval tasks. */
+        CronSchedule::clock_type::time_point cron_fire;
+        /**< @brief The wall-clock time of the cron task's most recently queued release. */
+        TaskHandle handle;
+        /**< @brief The task's handle-table slot; empty for tasks without a handle. */
+        std::size_t runs_left;
+        /**< @brief Executions left for a bounded task; `\`0\`` for unbounded. */
+        clock_type::time_point until;
+        /**< @brief The last release a bounded task may execute. */
+    };
+
+    /**
+     * @brief One entry of the handle table.
+     */
+    struct HandleSlot {
+        std::atomic<std::uint32_t> generation{0};
+        /**< @brief Advanced when the slot's task is cancelled or finishes. */
+        std::atomic<std::uint32_t> next_free{0xFFFFFFFFu};
+        /**< @brief The next slot on the free list while this one is free. */
+    };
+
+    /**
+     * @brief The task table, with nodes drawn from `\`TaskPool\``.
+     */
+    using TaskTable = std::unordered_map<TaskId, Task, std::hash<TaskId>, std::equal_to<TaskId>,
+                                         PoolAllocator<std::pair<const TaskId, Task>>>;
+
+    /**
+     * @brief One pending execution of a task in the run queue.
+     */
+    struct QueueEntry {
+        clock_type::time_point release;
+        /**< @brief When the execution becomes due; the key of the run queue. */
+        clock_type::time_point deadline;
+        /**< @brief When the execution must have run; the key of the EDF ready heap. */
+        long long rank;
+        /**< @brief Copy of the task's rank, so ordering needs no task lookup. */
+        TaskId id;
+        /**< @brief The task this entry belongs to. */
+        bool deferred = false;
+        /**< @brief Set once the entry was postponed; it is not postponed a second time. */
+    };
+
+    /**
+     * @brief Inserts a task into the table and the run queue. Runs on the worker thread.
+     * @param[in] id The pre-allocated task identifier.
+     * @param[in] entry The first pending execution of the task.
+     * @param[in] task The task to insert.
+     */
+    void insert_task(const QueueEntry& entry, Task task);
+
+    /**
+     * @brief Registers a periodic task with optional limits and a cancellation handle.
+     * @param[in] interval The time interval (duration) between task executions.
+     * @param[in] runs The number of executions; `\`0\`` means unbounded.
+     * @param[in] until The last release time that may execute.
+     * @param[in] callback The function to be executed periodically.
+     * @param[in] priority The explicit task priority.
+     * @return A handle for the new task.
+     */
+    TaskHandle add_limited_task(std::chrono::milliseconds interval, std::size_t runs, clock_type::time_point until,
+                                std::function<void()> callback, int priority);
+
+    /**
+     * @brief Takes a free handle-table slot. Runs on the calling thread.
+     * @return A handle for the slot's current generation; empty if the table is full.
+     */
+    TaskHandle acquire_handle();
+
+    /**
+     * @brief Returns a handle-table slot.
+     * @param[in] slot A slot below `\`slot_count_\``.
+     */
+    HandleSlot& slot_at(std::uint32_t slot) const;
+
+    /**
+     * @brief Reports whether a task's handle has been cancelled.
+     * @param[in] task The task to check.
+     */
+    bool is_cancelled(const Task& task) const;
+
+    /**
+     * @brief Ends a handle and returns its slot to the free list. Runs on the worker thread.
+     *
+     * @details The slot's generation is advanced first, unless `\`cancel()\`` already did,
+     * so the handle is stale before the slot can be reused.
+     * @param[in] handle The handle of a task that is being erased; may be empty.
+     */
+    void release_handle(TaskHandle handle);
+
+    /**
+     * @brief Erases a task and releases its handle.
+     * @param[in] it The task to erase.
+     */
+    void erase_task(TaskTable::iterator it);
+
+    /**
+     * @brief Pushes an entry onto the run queue.
+     * @param[in] entry The entry to insert.
+     */
+    void push_entry(const QueueEntry& entry);
+
+    /**
+     * @brief Pops the earliest entry from the run queue.
+     * @return The entry with the smallest release time.
+     */
+    QueueEntry pop_entry();
+
+    /**
+     * @brief Drops the entries of removed and cancelled tasks from the run queue.
+     * @details Cancelled tasks are erased from the table as well.
+     */
+    void purge_queue();
+
+    /**
+     * @brief Runs one execution of a task and queues the next one.
+     * @details Removed tasks are skipped; one-shot jobs are erased after running.
+     * @param[in] entry The execution to run.
+     */
+    void dispatch(const QueueEntry& entry);
+
+    /**
+     * @brief Computes the next execution of a cron task.
+     *
+     * @details Looks up the next fire time after the later of now and the previous fire
+     * time, so a backwards wall-clock step cannot fire the same slot twice.
+     *
+     * @param[in,out] task The cron task; its `\`cron_fire\`` is advanced.
+     * @param[out] entry Receives the release and deadline of the next execution.
+     * @return `false` if the schedule will never fire again.
+     */
+    static bool next_cron_entry(Task& task, QueueEntry& entry);
+
+    /**
+     * @brief The EDF dispatch step.
+     *
+     * @details Moves released entries to the ready heap, runs the ready job with the
+     * earliest deadline and posts itself again, so control operations interleave
+     * with the jobs. When nothing is ready the timer is armed for the next release.
+     */
+    void run_ready();
+
+    /**
+     * @brief Arms the timer for the earliest pending release, if there is one.
+     */
+    void arm_timer();
+
+    /**
+     * @brief The dispatch loop, invoked when the timer expires.
+     *
+     * @details Collects all due entries, orders them by rank, postpones those that
+     * must yield to an imminent higher-priority deadline, runs the rest and re-arms
+     * each of them relative to its previous deadline.
+     *
+     * @param[in] error The error code of the wait; `\`operation_aborted\`` when the
+     * timer was re-armed or the scheduler stopped.
+     */
+    void handle_wait(const boost::system::error_code& error);
+
+    boost::asio::io_context io_context_;
+    /**< @brief Boost.Asio's execution context, managing the task queue. */
+    boost::asio::steady_timer timer_;
+    /**< @brief The single timer armed for the earliest task deadline. */
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> work_guard_;
+    /**< @brief Prevents `\`io_context::run()\`` from exiting while no task is registered. */
+    boost::thread worker_thread_;
+    /**< @brief The dedicated thread that calls `\`io_context::run()\`` and dispatches tasks. */
+    PriorityPolicy policy_;
+    /**< @brief How tasks that are due together are ordered. */
+    TaskTable tasks_;
+    /**< @brief All registered tasks; entries of removed tasks are dropped lazily from the queue. */
+    std::vector<QueueEntry> queue_;
+    /**< @brief Min-heap of pending executions ordered by release time. */
+    std::vector<QueueEntry> ready_;
+    /**< @brief EDF only: min-heap of released executions ordered by deadline. */
+    bool draining_ = false;
+    /**< @brief EDF only: `true` while `\`run_ready()\`` is working through `\`ready_\``. */
+    std::vector<QueueEntry> due_;
+    /**< @brief Scratch buffer for the entries dispatched in one wakeup. */
+    std::vector<QueueEntry> deferred_;
+    /**< @brief Due entries postponed in favour of an imminent higher-priority task. */
+    std::vector<QueueEntry> imminent_;
+    /**< @brief Scratch buffer for the entries inspected by the deferral look-ahead. */
+    std::chrono::microseconds deferral_window_{0};
+    /**< @brief Look-ahead for preempt-by-deferral; zero disables it. */
+    clock_type::time_point anchor_;
+    /**< @brief Common first-deadline base for tasks added before `\`start()\``. */
+    std::atomic<TaskId> next_id_{1};
+    /**< @brief Source of task identifiers, shared by all calling threads. */
+    static constexpr std::uint32_t segment_slots_ = 4096;
+    /**< @brief The number of handle-table slots allocated at once. */
+    static constexpr std::uint32_t max_segments_ = 1024;
+    /**< @brief The handle table's capacity in segments. */
+    std::atomic<HandleSlot*> segments_[max_segments_] = {};
+    /**< @brief The handle table; segments never move once published. */
+    std::atomic<std::uint32_t> slot_count_{0};
+    /**< @brief The number of slots created so far. */
+    std::mutex slot_mutex_;
+    /**< @brief Serializes the creation of slots and segments. */
+    std::atomic<std::uint64_t> free_head_{0xFFFFFFFFu};
+    /**< @brief The free-list head: a change counter in the high half, the slot in the low half. */
+    std::atomic<bool> is_running_{false};
+    /**< @brief State flag indicating if the worker thread is active. */
+};
+
+// PeriodicScheduler Implementation
+
+/**
+ * @fn PeriodicScheduler::PeriodicScheduler(PriorityPolicy policy)
+ * @brief Constructs a new `PeriodicScheduler` instance.
+ *
+ * @details Initializes the `\`steady_timer\`` and creates the `\`work_guard\`` that keeps
+ * the `\`io_context\`` alive while no task is pending. The run queue starts with room
+ * for 256 entries, so stale entries are purged in batches rather than on every push;
+ * purging a nearly empty queue would make each new task its front and re-arm the timer.
+ * The per-wakeup scratch buffers are reserved as well and keep their capacity, so
+ * dispatching does not allocate once they have grown to the largest due set.
+ * @param[in] policy How simultaneously-due tasks are ordered.
+ */
+inline PeriodicScheduler::PeriodicScheduler(PriorityPolicy policy)
+    : timer_(io_context_),
+      work_guard_(boost::asio::make_work_guard(io_context_)),
+      policy_(policy) {
+    queue_.reserve(256);
+    due_.reserve(64);
+    deferred_.reserve(64);
+    imminent_.reserve(64);
+}
+
+/**
+ * @fn PeriodicScheduler::~PeriodicScheduler()
+ * @brief Destructor for `PeriodicScheduler`.
+ *
+ * @details Ensures the worker thread is safely terminated by calling `\`stop()\``.
+ */
+inline PeriodicScheduler::~PeriodicScheduler() {
+    stop();
+    for (auto& segment : segments_) {
+        delete[] segment.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @fn PeriodicScheduler::start()
+ * @brief Starts the worker thread.
+ *
+ * @details Records the common anchor for tasks added before this call and launches a
+ * `\`boost::thread\`` that calls `\`io_context::run()\``. Insertions posted by earlier
+ * `\`add_task()\`` calls are processed as soon as the thread starts.
+ * @return `true` if the scheduler started; `false` if it was already running.
+ */
+inline bool PeriodicScheduler::start() {
+    if (is_running_) {
+        return false;
+    }
+    anchor_ = clock_type::now();
+    is_running_ = true;
+
+    worker_thread_ = boost::thread([this]() {
+        try {
+            io_context_.run();
+        } catch (const std::exception& ex) {
+            std::cerr << "Exception caught in io_context.run(): " << ex.what() << std::endl;
+        } catch (...) {
+            std::cerr << "Unknown exception caught in io_context.run()" << std::endl;
+        }
+    });
+    return true;
+}
+
+/**
+ * @fn PeriodicScheduler::stop()
+ * @brief Stops dispatching and joins the worker thread.
+ *
+ * @details Follows the same shutdown sequence as `\`PeriodicExecutor::stop()\``:
+ * cancel the timer, release the work guard, stop the `\`io_context\`` and join.
+ */
+inline void PeriodicScheduler::stop() {
+    if (!is_running_) {
+        return;
+    }
+    timer_.cancel();
+    work_guard_.reset();
+    io_context_.stop();
+
+    if (worker_thread_.joinable()) {
+        worker_thread_.join();
+    }
+    is_running_ = false;
+}
+
+/**
+ * @fn PeriodicScheduler::add_task(std::chrono::milliseconds interval, std::function<void()> callback, int priority)
+ * @brief Registers a periodic task.
+ *
+ * @details Allocates the identifier on the calling thread and posts the insertion to
+ * the worker. Under `\`PriorityPolicy::RateMonotonic\`` the rank is the negated period,
+ * so shorter periods compare higher.
+ * @param[in] interval The time interval (duration) between task executions.
+ * @param[in] callback The periodic function to execute.
+ * @param[in] priority The explicit task priority.
+ * @return The identifier of the new task.
+ */
+inline PeriodicScheduler::TaskId PeriodicScheduler::add_task(std::chrono::milliseconds interval,
+                                                             std::function<void()> callback, int priority) {
+    const TaskId id = next_id_++;
+    const long long rank = policy_ == PriorityPolicy::RateMonotonic ? -interval.count() : priority;
+    const bool aligned = !is_running_;
+    const auto added = clock_type::now();
+
+    boost::asio::post(io_context_, pooled([this, id, interval, rank, aligned, added, callback = std::move(callback)]() mutable {
+        const auto release = (aligned ? anchor_ : added) + interval;
+        insert_task(QueueEntry{release, release + interval, rank, id}, Task{interval, std::move(callback), rank, false, nullptr, {}, TaskHandle{}, 0, clock_type::time_point::max()});
+    }));
+    return id;
+}
+
+/**
+ * @fn PeriodicScheduler::post_at(clock_type::time_point deadline, std::function<void()> callback, int priority)
+ * @brief Submits a one-shot job.
+ *
+ * @details Under EDF the entry is released now and keyed by `\`deadline\``; under the
+ * priority policies it is released at `\`deadline\``.
+ * @param[in] deadline The absolute deadline of the job.
+ * @param[in] callback The function to execute once.
+ * @param[in] priority The explicit job priority.
+ * @return The identifier of the job.
+ */
+inline PeriodicScheduler::TaskId PeriodicScheduler::post_at(clock_type::time_point deadline,
+                                                            std::function<void()> callback, int priority) {
+    const TaskId id = next_id_++;
+    const long long rank = policy_ == PriorityPolicy::RateMonotonic ? std::numeric_limits<long long>::min() : priority;
+    const auto release = policy_ == PriorityPolicy::EarliestDeadlineFirst ? clock_type::now() : deadline;
+
+    boost::asio::post(io_context_, pooled([this, id, release, deadline, rank, callback = std::move(callback)]() mutable {
+        insert_task(QueueEntry{release, deadline, rank, id},
+                    Task{std::chrono::milliseconds::zero(), std::move(callback), rank, true, nullptr, {}, TaskHandle{}, 0,
+                         clock_type::time_point::max()});
+    }));
+    return id;
+}
+
+/**
+ * @fn PeriodicScheduler::schedule_after(std::chrono::milliseconds delay, std::function<void()> callback, int priority)
+ * @brief Submits a cancellable one-shot job.
+ *
+ * @details Shares the release and rank rules of `\`post_at()\``, with `\`now + delay\``
+ * as the deadline.
+ * @param[in] delay The time from now until the job runs.
+ * @param[in] callback The function to execute once.
+ * @param[in] priority The explicit job priority.
+ * @return A handle that cancels the job; empty, and the job dropped, if the handle table is full.
+ */
+inline PeriodicScheduler::TaskHandle PeriodicScheduler::schedule_after(std::chrono::milliseconds delay,
+                                                                       std::function<void()> callback, int priority) {
+    const TaskHandle handle = acquire_handle();
+    if (!handle.valid()) {
+        return handle;
+    }
+    const TaskId id = next_id_++;
+    const long long rank = policy_ == PriorityPolicy::RateMonotonic ? std::numeric_limits<long long>::min() : priority;
+    const auto now = clock_type::now();
+    const auto deadline = now + delay;
+    const auto release = policy_ == PriorityPolicy::EarliestDeadlineFirst ? now : deadline;
+
+    boost::asio::post(io_context_, pooled([this, id, release, deadline, rank, handle, callback = std::move(callback)]() mutable {
+        insert_task(QueueEntry{release, deadline, rank, id},
+                    Task{std::chrono::milliseconds::zero(), std::move(callback), rank, true, nullptr, {}, handle,
+                         0, clock_type::time_point::max()});
+    }));
+    return handle;
+}
+
+/**
+ * @fn PeriodicScheduler::add_bounded_task(std::chrono::milliseconds interval, std::size_t runs, std::function<void()> callback, int priority)
+ * @brief Registers a periodic task with a fixed number of executions.
+ * @param[in] interval The time interval (duration) between task executions.
+ * @param[in] runs The number of executions; `\`0\`` means unbounded.
+ * @param[in] callback The periodic function to execute.
+ * @param[in] priority The explicit task priority.
+ * @return A handle that cancels the remaining executions.
+ */
+inline PeriodicScheduler::TaskHandle PeriodicScheduler::add_bounded_task(std::chrono::milliseconds interval,
+                                                                         std::size_t runs,
+                                                                         std::function<void()> callback,
+                                                                         int priority) {
+    return add_limited_task(interval, runs, clock_type::time_point::max(), std::move(callback), priority);
+}
+
+/**
+ * @fn PeriodicScheduler::add_task_until(std::chrono::milliseconds interval, clock_type::time_point until, std::function<void()> callback, int priority)
+ * @brief Registers a periodic task that ends at an absolute time.
+ * @param[in] interval The time interval (duration) between task executions.
+ * @param[in] until The last release time that may execute.
+ * @param[in] callback The periodic function to execute.
+ * @param[in] priority The explicit task priority.
+ * @return A handle that cancels the remaining executions.
+ */
+inline PeriodicScheduler::TaskHandle PeriodicScheduler::add_task_until(std::chrono::milliseconds interval,
+                                                                       clock_type::time_point until,
+                                                                       std::function<void()> callback,
+                                                                       int priority) {
+    return add_limited_task(interval, 0, until, std::move(callback), priority);
+}
+
+/**
+ * @fn PeriodicScheduler::add_limited_task(std::chrono::milliseconds interval, std::size_t runs, clock_type::time_point until, std::function<void()> callback, int priority)
+ * @brief Registers a periodic task with limits and a handle-table slot.
+ *
+ * @details Follows `\`add_task()\`` for the first release and the rank. A task whose
+ * first release already lies after `\`until\`` is never queued; its slot is released at once.
+ * @param[in] interval The time interval (duration) between task executions.
+ * @param[in] runs The number of executions; `\`0\`` means unbounded.
+ * @param[in] until The last release time that may execute.
+ * @param[in] callback The periodic function to execute.
+ * @param[in] priority The explicit task priority.
+ * @return A handle for the new task; empty, and the task dropped, if the handle table is full.
+ */
+inline PeriodicScheduler::TaskHandle PeriodicScheduler::add_limited_task(std::chrono::milliseconds interval,
+                                                                         std::size_t runs,
+                                                                         clock_type::time_point until,
+                                                                         std::function<void()> callback,
+                                                                         int priority) {
+    const TaskHandle handle = acquire_handle();
+    if (!handle.valid()) {
+        return handle;
+    }
+    const TaskId id = next_id_++;
+    const long long rank = policy_ == PriorityPolicy::RateMonotonic ? -interval.count() : priority;
+    const bool aligned = !is_running_;
+    const auto added = clock_type::now();
+
+    boost::asio::post(io_context_, pooled([this, id, interval, runs, until, rank, aligned, added, handle,
+                                     callback = std::move(callback)]() mutable {
+        const auto release = (aligned ? anchor_ : added) + interval;
+        if (release > until) {
+            release_handle(handle);
+            return;
+        }
+        insert_task(QueueEntry{release, release + interval, rank, id},
+                    Task{interval, std::move(callback), rank, false, nullptr, {}, handle, runs, until});
+    }));
+    return handle;
+}
+
+/**
+ * @fn PeriodicScheduler::add_cron_task(std::shared_ptr<const CronSchedule> schedule, std::function<void()> callback, int priority)
+ * @brief Registers a calendar task.
+ *
+ * @details The first release is computed on the worker thread when the insertion is
+ * processed. A schedule that never fires is dropped without being queued.
+ * @param[in] schedule The calendar schedule.
+ * @param[in] callback The function to execute at each fire time.
+ * @param[in] priority The explicit task priority.
+ * @return The identifier of the new task.
+ */
+inline PeriodicScheduler::TaskId PeriodicScheduler::add_cron_task(std::shared_ptr<const CronSchedule> schedule,
+                                                                  std::function<void()> callback, int priority) {
+    const TaskId id = next_id_++;
+    const long long rank = policy_ == PriorityPolicy::RateMonotonic ? std::numeric_limits<long long>::min() : priority;
+
+    boost::asio::post(io_context_, pooled([this, id, rank, schedule = std::move(schedule),
+                                     callback = std::move(callback)]() mutable {
+        Task task{std::chrono::milliseconds::zero(), std::move(callback), rank, false, std::move(schedule), {},
+                  TaskHandle{}, 0, clock_type::time_point::max()};
+        QueueEntry entry{{}, {}, rank, id};
+        if (next_cron_entry(task, entry)) {
+            insert_task(entry, std::move(task));
+        }
+    }));
+    return id;
+}
+
+/**
+ * @fn PeriodicScheduler::remove_task(TaskId id)
+ * @brief Unregisters a periodic task.
+ *
+ * @details Posts the erase to the worker. The task's queue entry stays in the heap
+ * and is discarded when it reaches the top, which keeps removal O(1).
+ * @param[in] id The identifier returned by `\`add_task()\``.
+ */
+inline void PeriodicScheduler::remove_task(TaskId id) {
+    boost::asio::post(io_context_, pooled([this, id]() {
+        auto it = tasks_.find(id);
+        if (it != tasks_.end()) {
+            erase_task(it);
+        }
+    }));
+}
+
+/**
+ * @fn PeriodicScheduler::set_deferral_window(std::chrono::microseconds window)
+ * @brief Sets the preempt-by-deferral look-ahead.
+ * @param[in] window How far ahead to look for imminent higher-priority deadlines.
+ */
+inline void PeriodicScheduler::set_deferral_window(std::chrono::microseconds window) {
+    boost::asio::post(io_context_, pooled([this, window]() {
+        deferral_window_ = window;
+    }));
+}
+
+/**
+ * @fn PeriodicScheduler::cancel(TaskHandle handle)
+ * @brief Advances the slot's generation if the handle is current.
+ *
+ * @details Handles that were never issued by this scheduler are rejected by the
+ * bounds check, stale ones by the compare-and-swap.
+ * @param[in] handle A handle returned by this scheduler.
+ * @return `true` if this call cancelled the task.
+ */
+inline bool PeriodicScheduler::cancel(TaskHandle handle) {
+    if (!handle.valid() || handle.slot >= slot_count_.load(std::memory_order_acquire)) {
+        return false;
+    }
+    std::uint32_t expected = handle.generation;
+    return slot_at(handle.slot).generation.compare_exchange_strong(expected, expected + 1,
+                                                                   std::memory_order_acq_rel);
+}
+
+/**
+ * @fn PeriodicScheduler::active(TaskHandle handle) const
+ * @brief Compares the handle's generation with the slot's.
+ * @param[in] handle A handle returned by this scheduler.
+ * @return `true` if the task is neither cancelled nor finished.
+ */
+inline bool PeriodicScheduler::active(TaskHandle handle) const {
+    return handle.valid() && handle.slot < slot_count_.load(std::memory_order_acquire) &&
+           slot_at(handle.slot).generation.load(std::memory_order_acquire) == handle.generation;
+}
+
+/**
+ * @fn PeriodicScheduler::acquire_handle()
+ * @brief Pops a slot from the free list, or creates one.
+ *
+ * @details The counter in the head's high half changes on every push and pop, so a pop
+ * whose head was popped and pushed back meanwhile fails its compare-and-swap instead
+ * of installing a stale successor. Creating slots takes `\`slot_mutex_\``; a new
+ * segment is published before `\`slot_count_\`` covers it.
+ * @return A handle for the slot's current generation; empty if the table is full.
+ */
+inline PeriodicScheduler::TaskHandle PeriodicScheduler::acquire_handle() {
+    std::uint64_t head = free_head_.load(std::memory_order_acquire);
+    while (static_cast<std::uint32_t>(head) != 0xFFFFFFFFu) {
+        const std::uint32_t slot = static_cast<std::uint32_t>(head);
+        const std::uint64_t next = ((head >> 32) + 1) << 32 | slot_at(slot).next_free.load(std::memory_order_relaxed);
+        if (free_head_.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return TaskHandle{slot, slot_at(slot).generation.load(std::memory_order_acquire)};
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(slot_mutex_);
+    const std::uint32_t slot = slot_count_.load(std::memory_order_relaxed);
+    if (slot == segment_slots_ * max_segments_) {
+        return TaskHandle{};
+    }
+    if (slot % segment_slots_ == 0) {
+        segments_[slot / segment_slots_].store(new HandleSlot[segment_slots_], std::memory_order_release);
+    }
+    slot_count_.store(slot + 1, std::memory_order_release);
+    return TaskHandle{slot, 0};
+}
+
+/**
+ * @fn PeriodicScheduler::slot_at(std::uint32_t slot) const
+ * @brief Locates a slot in its segment.
+ * @param[in] slot A slot below `\`slot_count_\``.
+ * @return The slot.
+ */
+inline PeriodicScheduler::HandleSlot& PeriodicScheduler::slot_at(std::uint32_t slot) const {
+    return segments_[slot / segment_slots_].load(std::memory_order_acquire)[slot % segment_slots_];
+}
+
+/**
+ * @fn PeriodicScheduler::is_cancelled(const Task& task) const
+ * @brief Compares the task's handle generation with its slot's.
+ * @param[in] task The task to check.
+ * @return `true` if the task has a handle and it was cancelled.
+ */
+inline bool PeriodicScheduler::is_cancelled(const Task& task) const {
+    return task.handle.valid() &&
+           slot_at(task.handle.slot).generation.load(std::memory_order_acquire) != task.handle.generation;
+}
+
+/**
+ * @fn PeriodicScheduler::release_handle(TaskHandle handle)
+ * @brief Invalidates the handle and pushes its slot onto the free list.
+ * @param[in] handle The handle of a task that is being erased; may be empty.
+ */
+inline void PeriodicScheduler::release_handle(TaskHandle handle) {
+    if (!handle.valid()) {
+        return;
+    }
+    HandleSlot& slot = slot_at(handle.slot);
+    std::uint32_t expected = handle.generation;
+    slot.generation.compare_exchange_strong(expected, expected + 1, std::memory_order_acq_rel);
+
+    std::uint64_t head = free_head_.load(std::memory_order_relaxed);
+    std::uint64_t next;
+    do {
+        slot.next_free.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+        next = ((head >> 32) + 1) << 32 | handle.slot;
+    } while (!free_head_.compare_exchange_weak(head, next, std::memory_order_release, std::memory_order_relaxed));
+}
+
+/**
+ * @fn PeriodicScheduler::erase_task(TaskTable::iterator it)
+ * @brief Releases the task's handle and erases it from the table.
+ * @param[in] it The task to erase.
+ */
+inline void PeriodicScheduler::erase_task(TaskTable::iterator it) {
+    release_handle(it->second.handle);
+    tasks_.erase(it);
+}
+
+/**
+ * @fn PeriodicScheduler::insert_task(const QueueEntry& entry, Task task)
+ * @brief Inserts a task and re-arms the timer if it is now the earliest release.
+ *
+ * @details While the EDF loop is draining, the timer is left alone; `\`run_ready()\``
+ * picks up the new entry on its next step.
+ * @param[in] entry The first pending execution of the task.
+ * @param[in] task The task to insert.
+ */
+inline void PeriodicScheduler::insert_task(const QueueEntry& entry, Task task) {
+    tasks_.emplace(entry.id, std::move(task));
+    push_entry(entry);
+    if (!draining_ && queue_.front().id == entry.id) {
+        arm_timer();
+    }
+}
+
+/**
+ * @fn PeriodicScheduler::push_entry(const QueueEntry& entry)
+ * @brief Pushes an entry onto the release-time min-heap.
+ *
+ * @details Before the heap would grow, the stale entries left by lazy removal are
+ * purged, so add/remove churn reuses the existing capacity instead of reallocating.
+ * @param[in] entry The entry to insert.
+ */
+inline void PeriodicScheduler::push_entry(const QueueEntry& entry) {
+    if (queue_.size() == queue_.capacity() && !queue_.empty()) {
+        purge_queue();
+    }
+    queue_.push_back(entry);
+    std::push_heap(queue_.begin(), queue_.end(), [](const QueueEntry& a, const QueueEntry& b) {
+        return a.release > b.release;
+    });
+}
+
+/**
+ * @fn PeriodicScheduler::pop_entry()
+ * @brief Pops the earliest entry from the release-time min-heap.
+ * @return The entry with the smallest release time.
+ */
+inline PeriodicScheduler::QueueEntry PeriodicScheduler::pop_entry() {
+    std::pop_heap(queue_.begin(), queue_.end(), [](const QueueEntry& a, const QueueEntry& b) {
+        return a.release > b.release;
+    });
+    const QueueEntry entry = queue_.back();
+    queue_.pop_back();
+    return entry;
+}
+
+/**
+ * @fn PeriodicScheduler::purge_queue()
+ * @brief Removes stale entries and restores the heap.
+ *
+ * @details Each live task has at most one entry in flight, so after the purge the
+ * queue holds no more entries than the table holds tasks.
+ */
+inline void PeriodicScheduler::purge_queue() {
+    const auto stale = [this](const QueueEntry& entry) {
+        auto it = tasks_.find(entry.id);
+        if (it == tasks_.end()) {
+            return true;
+        }
+        if (is_cancelled(it->second)) {
+            erase_task(it);
+            return true;
+        }
+        return false;
+    };
+    queue_.erase(std::remove_if(queue_.begin(), queue_.end(), stale), queue_.end());
+    std::make_heap(queue_.begin(), queue_.end(), [](const QueueEntry& a, const QueueEntry& b) {
+        return a.release > b.release;
+    });
+}
+
+/**
+ * @fn PeriodicScheduler::dispatch(const QueueEntry& entry)
+ * @brief Runs one execution and queues the next.
+ *
+ * @details The next execution of a periodic task is released one interval after the
+ * previous release, not after the callback returned, to prevent drift. Cancelled
+ * tasks are erased instead of run, and bounded tasks are erased after their last
+ * execution, which releases their callbacks.
+ * @param[in] entry The execution to run.
+ */
+inline void PeriodicScheduler::dispatch(const QueueEntry& entry) {
+    auto it = tasks_.find(entry.id);
+    if (it == tasks_.end()) {
+        return; // removed since it was queued
+    }
+    if (is_cancelled(it->second)) {
+        erase_task(it);
+        return;
+    }
+    it->second.callback();
+    if (it->second.one_shot || (it->second.runs_left != 0 && --it->second.runs_left == 0)) {
+        erase_task(it);
+        return;
+    }
+    if (it->second.cron) {
+        QueueEntry next{{}, {}, entry.rank, entry.id};
+        if (next_cron_entry(it->second, next)) {
+            push_entry(next);
+        } else {
+            erase_task(it);
+        }
+        return;
+    }
+    const auto interval = it->second.interval;
+    if (entry.release + interval > it->second.until) {
+        erase_task(it);
+        return;
+    }
+    push_entry(QueueEntry{entry.release + interval, entry.deadline + interval, entry.rank, entry.id});
+}
+
+/**
+ * @fn PeriodicScheduler::next_cron_entry(Task& task, QueueEntry& entry)
+ * @brief Computes the next execution of a cron task.
+ *
+ * @details Both wall-clock and steady-clock time are sampled once; the release is the
+ * steady time now plus the wall-clock distance to the next fire time.
+ * @param[in,out] task The cron task.
+ * @param[out] entry Receives the release and deadline.
+ * @return `false` if the schedule will never fire again.
+ */
+inline bool PeriodicScheduler::next_cron_entry(Task& task, QueueEntry& entry) {
+    const auto wall_now = CronSchedule::clock_type::now();
+    const auto steady_now = clock_type::now();
+    const auto fire = task.cron->next(std::max(wall_now, task.cron_fire));
+    if (fire == CronSchedule::clock_type::time_point::max()) {
+        return false;
+    }
+    const auto following = task.cron->next(fire);
+    task.cron_fire = fire;
+    entry.release = steady_now + std::chrono::duration_cast<clock_type::duration>(fire - wall_now);
+    entry.deadline = following == CronSchedule::clock_type::time_point::max()
+        ? entry.release
+        : steady_now + std::chrono::duration_cast<clock_type::duration>(following - wall_now);
+    return true;
+}
+
+/**
+ * @fn PeriodicScheduler::run_ready()
+ * @brief The EDF dispatch step.
+ *
+ * @details Exactly one `\`run_ready()\`` chain is active while `\`draining_\`` is set; it
+ * ends by arming the timer once the ready heap is empty.
+ */
+inline void PeriodicScheduler::run_ready() {
+    const auto by_deadline = [](const QueueEntry& a, const QueueEntry& b) {
+        return a.deadline > b.deadline;
+    };
+    const auto now = clock_type::now();
+    while (!queue_.empty() && queue_.front().release <= now) {
+        ready_.push_back(pop_entry());
+        std::push_heap(ready_.begin(), ready_.end(), by_deadline);
+    }
+    if (ready_.empty()) {
+        draining_ = false;
+        arm_timer();
+        return;
+    }
+    draining_ = true;
+    std::pop_heap(ready_.begin(), ready_.end(), by_deadline);
+    const QueueEntry entry = ready_.back();
+    ready_.pop_back();
+    dispatch(entry);
+    boost::asio::post(io_context_, pooled([this]() { run_ready(); }));
+}
+
+/**
+ * @fn PeriodicScheduler::arm_timer()
+ * @brief Arms the timer for the earliest pending release.
+ *
+ * @details `\`expires_at()\`` cancels any wait that is still outstanding, so at most one
+ * live `\`handle_wait\`` exists after this call; the cancelled one returns early on
+ * `\`operation_aborted\``.
+ */
+inline void PeriodicScheduler::arm_timer() {
+    if (queue_.empty()) {
+        return;
+    }
+    timer_.expires_at(queue_.front().release);
+    timer_.async_wait(pooled(std::bind(&PeriodicScheduler::handle_wait, this, std::placeholders::_1)));
+}
+
+/**
+ * @fn PeriodicScheduler::handle_wait(const boost::system::error_code& error)
+ * @brief The core dispatch loop.
+ *
+ * @details Under EDF this hands over to `\`run_ready()\``. Otherwise, postponed entries
+ * from the previous wakeup are dispatched together with the newly due ones. The due
+ * set is sorted by descending rank (ties by release time).
+ * If deferral is enabled, entries released within the window are popped
+ * to find the highest imminent rank; due entries ranked below it are parked in
+ * `\`deferred_\`` and the timer is armed for the imminent release instead.
+ * An entry is postponed at most once: on the next wakeup it is dispatched even if
+ * another higher-priority release is imminent, so higher-priority releases that keep
+ * falling inside the window cannot starve it.
+ * @param[in] error The error code from the Boost.Asio asynchronous operation.
+ */
+inline void PeriodicScheduler::handle_wait(const boost::system::error_code& error) {
+    if (error == boost::asio::error::operation_aborted) {
+        return;
+    }
+    if (policy_ == PriorityPolicy::EarliestDeadlineFirst) {
+        run_ready();
+        return;
+    }
+
+    const auto now = clock_type::now();
+    due_.swap(deferred_);
+    deferred_.clear();
+    while (!queue_.empty() && queue_.front().release <= now) {
+        due_.push_back(pop_entry());
+    }
+    std::sort(due_.begin(), due_.end(), [](const QueueEntry& a, const QueueEntry& b) {
+        return a.rank != b.rank ? a.rank > b.rank : a.release < b.release;
+    });
+
+    if (deferral_window_.count() > 0 && !due_.empty()) {
+        // Find the most urgent task that becomes due within the window.
+        long long imminent_rank = std::numeric_limits<long long>::min();
+        const auto horizon = now + deferral_window_;
+        while (!queue_.empty() && queue_.front().release <= horizon) {
+            imminent_.push_back(pop_entry());
+            if (tasks_.count(imminent_.back().id) != 0) {
+                imminent_rank = std::max(imminent_rank, imminent_.back().rank);
+            }
+        }
+        for (const QueueEntry& entry : imminent_) {
+            push_entry(entry);
+        }
+        imminent_.clear();
+        // Entries are sorted by rank, so the ones to defer form the tail. Entries
+        // postponed before stay in place to keep their rank order.
+        std::size_t kept = due_.size();
+        while (kept > 0 && due_[kept - 1].rank < imminent_rank) {
+            --kept;
+        }
+        for (std::size_t i = kept; i < due_.size(); ++i) {
+            if (due_[i].deferred) {
+                due_[kept++] = due_[i];
+            } else {
+                deferred_.push_back(due_[i]);
+                deferred_.back().deferred = true;
+            }
+        }
+        due_.resize(kept);
+    }
+
+    for (const QueueEntry& entry : due_) {
+        dispatch(entry);
+    }
+    due_.clear();
+
+    arm_timer();
+}
+
+#endif // PERIODIC_SCHEDULER_HPP
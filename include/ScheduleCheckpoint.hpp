@@ -0,0 +1,277 @@
+#ifndef SCHEDULE_CHECKPOINT_HPP
+#define SCHEDULE_CHECKPOINT_HPP
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <system_error>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file
+ * @brief Header file for the ScheduleCheckpoint class.
+ */
+
+/**
+ * @brief Where a checkpointed executor continues its grid.
+ */
+struct ScheduleResume {
+    std::chrono::steady_clock::time_point anchor;
+    /**< @brief The grid origin; deadline `\`k\`` lies at `\`anchor + k*interval\``. */
+    std::uint64_t next_index;
+    /**< @brief The index of the first deadline to wait for. */
+    std::uint64_t missed;
+    /**< @brief Deadlines that passed unexecuted since the last recorded one. */
+    bool restored;
+    /**< @brief `\`true\`` if the grid was taken from the file, `\`false\`` for a fresh grid. */
+};
+
+/**
+ * @class ScheduleCheckpoint
+ * @brief Persists an executor's grid in a small memory-mapped file (POSIX only).
+ *
+ * @details A restarted service normally starts every executor on a new grid
+ * `\`now + k*interval\``, which skews the interval across the restart and repeats work
+ * already done. With a checkpoint, the executor stores its anchor and interval once per
+ * `\`start()\`` and the index of each executed deadline with a single relaxed store into
+ * the mapping. The next `\`start()\`` with the same interval, also from a new process,
+ * continues on the same grid and reports the deadlines missed in between.
+ *
+ * The anchor is stored as `\`system_clock\`` time, so the grid survives reboots; a wall
+ * clock step while the service is down shifts the grid by the step. Stores reach the file
+ * through the page cache and survive process crashes; call `\`sync()\`` to make them
+ * survive a power loss as well.
+ */
+class ScheduleCheckpoint {
+public:
+    /**
+     * @brief Opens or creates the checkpoint file and maps it.
+     * @param[in] path The file; a missing, short or foreign file yields a fresh grid.
+     * @throws std::system_error If the file cannot be opened, sized or mapped.
+     */
+    explicit ScheduleCheckpoint(const std::string& path);
+
+    /**
+     * @brief Destructor for `ScheduleCheckpoint`.
+     * @details Unmaps the file; the stored state stays for the next run.
+     */
+    ~ScheduleCheckpoint();
+
+    /**
+     * @brief Computes where to continue and stores the grid for this run.
+     *
+     * @details Called by `\`PeriodicExecutor::start()\``. If the file holds a grid with the
+     * same interval, the next deadline is the first grid point after now; otherwise a new
+     * grid is anchored at now.
+     *
+     * @param[in] interval The executor's interval.
+     * @return The grid to follow.
+     */
+    ScheduleResume begin(std::chrono::nanoseconds interval);
+
+    /**
+     * @brief Replaces the stored grid by one anchored at the deadline just executed.
+     *
+     * @details Called by the executor's worker when an adaptive interval changes, so the
+     * stored anchor and interval keep describing the deadlines being recorded. The
+     * anchor becomes deadline `\`0\`` of the new grid.
+     *
+     * @param[in] anchor The new grid origin.
+     * @param[in] interval The new interval.
+     */
+    void rebase(std::chrono::steady_clock::time_point anchor, std::chrono::nanoseconds interval);
+
+    /**
+     * @brief Records that deadline `\`index\`` has been executed. Called by the executor's worker.
+     * @param[in] index The deadline index.
+     */
+    void record(std::uint64_t index);
+
+    /**
+     * @brief Returns the index of the last executed deadline.
+     */
+    std::uint64_t last_index() const;
+
+    /**
+     * @brief Returns the number of deadlines missed before the latest `\`begin()\``.
+     */
+    std::uint64_t missed() const;
+
+    /**
+     * @brief Writes the mapping back to disk with `\`msync()\``.
+     */
+    void sync();
+
+    // The executor refers to the checkpoint and the mapping is owned by it.
+    ScheduleCheckpoint(const ScheduleCheckpoint&) = delete;
+    ScheduleCheckpoint& operator=(const ScheduleCheckpoint&) = delete;
+
+private:
+    /**
+     * @brief The 64-byte file layout.
+     */
+    struct State {
+        char magic[8];
+        /**< @brief `\`PECKPT01\``. */
+        std::int64_t interval_ns;
+        /**< @brief The interval of the stored grid. */
+        std::int64_t anchor_ns;
+        /**< @brief The grid origin as `\`system_clock\`` nanoseconds since the epoch. */
+        std::atomic<std::uint64_t> last_index;
+        /**< @brief The index of the last executed deadline; `\`0\`` if none. */
+        std::uint64_t reserved[4];
+        /**< @brief Zero. */
+    };
+
+    static_assert(sizeof(State) == 64, "ScheduleCheckpoint file layout changed");
+
+    static constexpr char magic_[8] = {'P', 'E', 'C', 'K', 'P', 'T', '0', '1'};
+    /**< @brief The expected file magic. */
+
+    int fd_ = -1;
+    /**< @brief The checkpoint file. */
+    State* state_ = nullptr;
+    /**< @brief The mapped state. */
+    std::uint64_t missed_ = 0;
+    /**< @brief The result of the latest `\`begin()\``. */
+};
+
+// ScheduleCheckpoint Implementation
+
+/**
+ * @fn ScheduleCheckpoint::ScheduleCheckpoint(const std::string& path)
+ * @brief Opens, sizes and maps the file.
+ *
+ * @details A file shorter than the state is extended with zeros, which `\`begin()\``
+ * treats as "no grid stored".
+ */
+inline ScheduleCheckpoint::ScheduleCheckpoint(const std::string& path) {
+#if defined(__unix__) || defined(__APPLE__)
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw std::system_error(errno, std::generic_category(), "ScheduleCheckpoint: cannot open " + path);
+    }
+    struct stat status {};
+    if (::fstat(fd_, &status) != 0 ||
+        (static_cast<std::size_t>(status.st_size) < sizeof(State) && ::ftruncate(fd_, sizeof(State)) != 0)) {
+        const int error = errno;
+        ::close(fd_);
+        throw std::system_error(error, std::generic_category(), "ScheduleCheckpoint: cannot size " + path);
+    }
+    void* memory = ::mmap(nullptr, sizeof(State), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (memory == MAP_FAILED) {
+        const int error = errno;
+        ::close(fd_);
+        throw std::system_error(error, std::generic_category(), "ScheduleCheckpoint: cannot map " + path);
+    }
+    state_ = static_cast<State*>(memory);
+#else
+    throw std::system_error(std::make_error_code(std::errc::function_not_supported),
+                            "ScheduleCheckpoint: memory-mapped files are not supported on this platform: " + path);
+#endif
+}
+
+/**
+ * @fn ScheduleCheckpoint::~ScheduleCheckpoint()
+ * @brief Unmaps and closes the file.
+ */
+inline ScheduleCheckpoint::~ScheduleCheckpoint() {
+#if defined(__unix__) || defined(__APPLE__)
+    ::munmap(state_, sizeof(State));
+    ::close(fd_);
+#endif
+}
+
+/**
+ * @fn ScheduleCheckpoint::begin(std::chrono::nanoseconds interval)
+ * @brief Restores or creates the grid.
+ *
+ * @details The stored anchor is translated into `\`steady_clock\`` by subtracting its age,
+ * measured on `\`system_clock\``, from the current steady time. Deadline `\`k\`` is due once
+ * `\`k*interval\`` has elapsed since the anchor, so the deadlines `\`last_index + 1\`` up
+ * to `\`floor(elapsed/interval)\`` are the ones missed.
+ */
+inline ScheduleResume ScheduleCheckpoint::begin(std::chrono::nanoseconds interval) {
+    const auto steady_now = std::chrono::steady_clock::now();
+    const std::int64_t system_now =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+    ScheduleResume resume{steady_now, 1, 0, false};
+    if (std::memcmp(state_->magic, magic_, sizeof(magic_)) == 0 && state_->interval_ns == interval.count() &&
+        interval.count() > 0 && state_->anchor_ns <= system_now) {
+        const std::int64_t elapsed = system_now - state_->anchor_ns;
+        const auto due = static_cast<std::uint64_t>(elapsed / interval.count());
+        const std::uint64_t last = state_->last_index.load(std::memory_order_relaxed);
+        resume.anchor = steady_now - std::chrono::nanoseconds(elapsed);
+        resume.next_index = due + 1;
+        resume.missed = due > last ? due - last : 0;
+        resume.restored = true;
+    } else {
+        std::memset(static_cast<void*>(state_), 0, sizeof(State));
+        new (&state_->last_index) std::atomic<std::uint64_t>(0);
+        state_->interval_ns = interval.count();
+        state_->anchor_ns = system_now;
+        std::memcpy(state_->magic, magic_, sizeof(magic_));
+    }
+    state_->last_index.store(resume.next_index - 1, std::memory_order_relaxed);
+    missed_ = resume.missed;
+    return resume;
+}
+
+/**
+ * @fn ScheduleCheckpoint::rebase(std::chrono::steady_clock::time_point anchor, std::chrono::nanoseconds interval)
+ * @brief Stores a new grid.
+ *
+ * @details The anchor is translated into `\`system_clock\`` by its age, as in `\`begin()\``.
+ */
+inline void ScheduleCheckpoint::rebase(std::chrono::steady_clock::time_point anchor, std::chrono::nanoseconds interval) {
+    const auto age = std::chrono::steady_clock::now() - anchor;
+    state_->anchor_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch() - age).count();
+    state_->interval_ns = interval.count();
+    state_->last_index.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @fn ScheduleCheckpoint::record(std::uint64_t index)
+ * @brief One relaxed store into the mapping.
+ */
+inline void ScheduleCheckpoint::record(std::uint64_t index) {
+    state_->last_index.store(index, std::memory_order_relaxed);
+}
+
+/**
+ * @fn ScheduleCheckpoint::last_index() const
+ * @brief Reads the last executed deadline index.
+ */
+inline std::uint64_t ScheduleCheckpoint::last_index() const {
+    return state_->last_index.load(std::memory_order_relaxed);
+}
+
+/**
+ * @fn ScheduleCheckpoint::missed() const
+ * @brief Returns the deadlines missed before the latest `\`begin()\``.
+ */
+inline std::uint64_t ScheduleCheckpoint::missed() const {
+    return missed_;
+}
+
+/**
+ * @fn ScheduleCheckpoint::sync()
+ * @brief Flushes the mapping synchronously.
+ */
+inline void ScheduleCheckpoint::sync() {
+#if defined(__unix__) || defined(__APPLE__)
+    ::msync(state_, sizeof(State), MS_SYNC);
+#endif
+}
+
+#endif // SCHEDULE_CHECKPOINT_HPP
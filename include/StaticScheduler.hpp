@@ -0,0 +1,536 @@
+#ifndef STATIC_SCHEDULER_HPP
+#define STATIC_SCHEDULER_HPP
+#include <boost/thread.hpp>
+#include "InplaceFunction.hpp"
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <utility>
+
+/**
+ * @file
+ * @brief Header file for the StaticScheduler class template.
+ */
+
+/**
+ * @class StaticScheduler
+ * @brief A fixed-capacity periodic scheduler that never allocates after construction.
+ *
+ * @details `\`PeriodicScheduler\`` keeps its tasks in a hash map, its queues in vectors
+ * and posts every control operation to an `\`io_context\``, all of which allocate. Here
+ * the task slots, the run queue and the callbacks live in arrays inside the scheduler
+ * object, sized by the template parameters:
+ * - a slot per task, holding the callback in an `\`InplaceFunction\`` of `\`CallableSize\`` bytes;
+ * - a binary min-heap of slot indices ordered by release time, with each slot remembering
+ *   its heap position so that cancellation removes it in O(log n);
+ * - a free list threaded through the unused slots.
+ *
+ * The worker waits on a condition variable with `\`wait_until()\`` instead of an
+ * Asio timer, since Asio may allocate operation state for each wait. Registering,
+ * firing and cancelling tasks therefore only touch the scheduler object; the only
+ * allocations happen in `\`start()\``, which creates the worker thread.
+ *
+ * Control functions take a mutex that the worker releases while a callback runs, so
+ * they may be called from any thread, including from within a callback. Tasks are
+ * re-armed relative to their previous release, as in `\`PeriodicExecutor\``.
+ *
+ * @tparam MaxTasks The number of task slots.
+ * @tparam CallableSize The inline storage for each callback in bytes.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize = 64>
+class StaticScheduler {
+    static_assert(MaxTasks > 0 && MaxTasks < 0xFFFFFFFFu, "StaticScheduler needs between 1 and 2^32-2 slots");
+
+public:
+    /**
+     * @brief The clock used for all task deadlines.
+     */
+    using clock_type = std::chrono::steady_clock;
+
+    /**
+     * @brief The callback type; callables larger than `\`CallableSize\`` do not compile.
+     */
+    using Callback = InplaceFunction<void(), CallableSize>;
+
+    /**
+     * @brief Identifies a task by its slot and the slot's generation.
+     *
+     * @details A slot's generation is advanced whenever its task ends, so a handle to a
+     * cancelled or finished task no longer matches and is rejected. A default-constructed
+     * handle, or one returned when the scheduler was full, refers to no task.
+     */
+    struct TaskHandle {
+        std::uint32_t slot = 0xFFFFFFFFu;
+        /**< @brief The slot index; `\`0xFFFFFFFF\`` for an empty handle. */
+        std::uint32_t generation = 0;
+        /**< @brief The slot generation the task was registered in. */
+
+        /**
+         * @brief Reports whether the handle was returned for a registered task.
+         */
+        bool valid() const { return slot != 0xFFFFFFFFu; }
+    };
+
+    /**
+     * @brief Constructs a stopped scheduler with all slots free.
+     */
+    StaticScheduler();
+
+    /**
+     * @brief Destructor for `StaticScheduler`.
+     * @details Calls `\`stop()\`` to join the worker thread before the slots are destroyed.
+     */
+    ~StaticScheduler();
+
+    /**
+     * @brief Starts the worker thread.
+     *
+     * @details Tasks added before `\`start()\`` share a common anchor, so tasks with the
+     * same period become due in the same wakeup. After `\`stop()\`` the queued tasks resume
+     * with their phases kept, shifted by the time the scheduler was stopped.
+     *
+     * @return `true` if the scheduler was started, `false` if it was already running.
+     */
+    bool start();
+
+    /**
+     * @brief Stops dispatching and joins the worker thread.
+     * @details Registered tasks are kept. Can be called multiple times.
+     */
+    void stop();
+
+    /**
+     * @brief Registers a periodic task without allocating.
+     *
+     * @details Safe to call from any thread. The first execution is due one `\`interval\``
+     * after `\`start()\`` for tasks added before the scheduler runs, and one `\`interval\``
+     * after this call otherwise.
+     *
+     * @param[in] interval The time interval (duration) between task executions.
+     * @param[in] callback The function to execute; stored inline in the slot.
+     * @return A handle for the task, or an empty handle if all slots are taken.
+     */
+    template <typename F>
+    TaskHandle add_task(std::chrono::milliseconds interval, F&& callback);
+
+    /**
+     * @brief Cancels a task and frees its slot.
+     *
+     * @details Safe to call from any thread, including from the task's own callback. A
+     * callback that is already running completes normally; its slot is freed afterwards.
+     *
+     * @param[in] handle The handle returned by `\`add_task()\``.
+     * @return `true` if the task was cancelled, `false` if the handle was empty or stale.
+     */
+    bool cancel(TaskHandle handle);
+
+    /**
+     * @brief Returns the number of registered tasks.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the number of task slots.
+     */
+    static constexpr std::size_t capacity() { return MaxTasks; }
+
+    // The worker thread refers to the scheduler and the slots own the callbacks.
+    StaticScheduler(const StaticScheduler&) = delete;
+    StaticScheduler& operator=(const StaticScheduler&) = delete;
+
+private:
+    /**
+     * @brief The life cycle of a task slot.
+     */
+    enum class SlotState : std::uint8_t {
+        Free,     /**< @brief On the free list. */
+        Queued,   /**< @brief Registered and in the run queue. */
+        Running,  /**< @brief Its callback is executing on the worker. */
+        Cancelled /**< @brief Cancelled while running; freed when the callback returns. */
+    };
+
+    /**
+     * @brief A task slot.
+     */
+    struct Slot {
+        Callback callback;
+        /**< @brief The user-supplied periodic task. */
+        clock_type::time_point release;
+        /**< @brief The next release; relative to `\`anchor_\`` while the scheduler is stopped. */
+        std::chrono::milliseconds interval{0};
+        /**< @brief The desired period between executions. */
+        std::uint32_t generation = 0;
+        /**< @brief Advanced whenever the task in this slot ends. */
+        std::uint32_t link = 0;
+        /**< @brief The heap position while queued, the next free slot while free. */
+        SlotState state = SlotState::Free;
+        /**< @brief Where the slot is in its life cycle. */
+    };
+
+    /**
+     * @brief The dispatch loop run by the worker thread.
+     */
+    void run();
+
+    /**
+     * @brief Returns a slot's task to the free list and invalidates its handles.
+     * @param[in] index The slot index.
+     */
+    void release_slot(std::uint32_t index);
+
+    /**
+     * @brief Inserts a slot into the run queue.
+     * @param[in] index The slot index.
+     */
+    void heap_push(std::uint32_t index);
+
+    /**
+     * @brief Removes the entry at `\`position\`` from the run queue.
+     * @param[in] position The heap position.
+     */
+    void heap_remove(std::uint32_t position);
+
+    /**
+     * @brief Moves the entry at `\`position\`` towards the root while it is earlier than its parent.
+     */
+    void sift_up(std::uint32_t position);
+
+    /**
+     * @brief Moves the entry at `\`position\`` towards the leaves while a child is earlier.
+     */
+    void sift_down(std::uint32_t position);
+
+    /**
+     * @brief Places slot `\`index\`` at heap position `\`position\`` and records the position.
+     */
+    void heap_place(std::uint32_t position, std::uint32_t index);
+
+    static constexpr std::uint32_t no_slot_ = 0xFFFFFFFFu;
+    /**< @brief Marks the end of the free list. */
+
+    std::array<Slot, MaxTasks> slots_;
+    /**< @brief All task slots, including their callbacks. */
+    std::array<std::uint32_t, MaxTasks> heap_;
+    /**< @brief Min-heap of queued slot indices ordered by release time. */
+    std::uint32_t heap_size_ = 0;
+    /**< @brief The number of queued slots. */
+    std::uint32_t free_head_ = 0;
+    /**< @brief The first free slot, or `\`no_slot_\``. */
+    std::size_t task_count_ = 0;
+    /**< @brief The number of registered tasks. */
+    mutable std::mutex mutex_;
+    /**< @brief Guards the slots and the run queue. */
+    std::condition_variable wakeup_;
+    /**< @brief Wakes the worker when a new earliest release arrives or on `\`stop()\``. */
+    clock_type::time_point anchor_{};
+    /**< @brief The common first-deadline base; the epoch before the first `\`start()\``, then the last stop time. */
+    bool stopping_ = false;
+    /**< @brief Set under the mutex by `\`stop()\`` to end the dispatch loop. */
+    bool is_running_ = false;
+    /**< @brief State flag indicating if the worker thread is active. */
+    boost::thread worker_thread_;
+    /**< @brief The dedicated thread that runs the dispatch loop. */
+};
+
+// StaticScheduler Implementation
+
+/**
+ * @fn StaticScheduler::StaticScheduler()
+ * @brief Threads all slots onto the free list.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+StaticScheduler<MaxTasks, CallableSize>::StaticScheduler() {
+    for (std::uint32_t i = 0; i < MaxTasks; ++i) {
+        slots_[i].link = i + 1 < MaxTasks ? i + 1 : no_slot_;
+    }
+}
+
+/**
+ * @fn StaticScheduler::~StaticScheduler()
+ * @brief Destructor for `StaticScheduler`.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+StaticScheduler<MaxTasks, CallableSize>::~StaticScheduler() {
+    stop();
+}
+
+/**
+ * @fn StaticScheduler::start()
+ * @brief Anchors the early tasks and launches the worker thread.
+ *
+ * @details While stopped, queued releases are relative to `\`anchor_\``: the clock's epoch
+ * before the first start, the stop time afterwards. Shifting them all by the time since
+ * the anchor keeps their heap order, so no re-heapify is needed.
+ * @return `true` if the scheduler started; `false` if it was already running.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+bool StaticScheduler<MaxTasks, CallableSize>::start() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (is_running_) {
+        return false;
+    }
+    const auto now = clock_type::now();
+    const auto shift = now - anchor_;
+    anchor_ = now;
+    for (std::uint32_t i = 0; i < heap_size_; ++i) {
+        slots_[heap_[i]].release += shift;
+    }
+    stopping_ = false;
+    is_running_ = true;
+    lock.unlock();
+
+    worker_thread_ = boost::thread([this]() {
+        try {
+            run();
+        } catch (const std::exception& ex) {
+            std::cerr << "Exception caught in StaticScheduler::run(): " << ex.what() << std::endl;
+        } catch (...) {
+            std::cerr << "Unknown exception caught in StaticScheduler::run()" << std::endl;
+        }
+    });
+    return true;
+}
+
+/**
+ * @fn StaticScheduler::stop()
+ * @brief Ends the dispatch loop and joins the worker thread.
+ *
+ * @details Records the stop time as the anchor so a later `\`start()\`` can shift the
+ * queued releases past the stopped period.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+void StaticScheduler<MaxTasks, CallableSize>::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!is_running_) {
+            return;
+        }
+        stopping_ = true;
+    }
+    wakeup_.notify_one();
+    if (worker_thread_.joinable()) {
+        worker_thread_.join();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    anchor_ = clock_type::now();
+    is_running_ = false;
+}
+
+/**
+ * @fn StaticScheduler::add_task(std::chrono::milliseconds interval, F&& callback)
+ * @brief Takes a slot from the free list and queues the task.
+ *
+ * @details The callback is constructed in place in the slot. The worker is only
+ * woken if the new task is now the earliest release.
+ * @param[in] interval The time interval (duration) between task executions.
+ * @param[in] callback The function to execute.
+ * @return A handle for the task, or an empty handle if all slots are taken.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+template <typename F>
+typename StaticScheduler<MaxTasks, CallableSize>::TaskHandle
+StaticScheduler<MaxTasks, CallableSize>::add_task(std::chrono::milliseconds interval, F&& callback) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (free_head_ == no_slot_) {
+        return TaskHandle{};
+    }
+    const std::uint32_t index = free_head_;
+    Slot& slot = slots_[index];
+    free_head_ = slot.link;
+    ++task_count_;
+
+    slot.callback = Callback(std::forward<F>(callback));
+    slot.interval = interval;
+    slot.release = (is_running_ ? clock_type::now() : anchor_) + interval;
+    slot.state = SlotState::Queued;
+    heap_push(index);
+    const bool earliest = heap_[0] == index;
+    const TaskHandle handle{index, slot.generation};
+    lock.unlock();
+
+    if (earliest) {
+        wakeup_.notify_one();
+    }
+    return handle;
+}
+
+/**
+ * @fn StaticScheduler::cancel(TaskHandle handle)
+ * @brief Cancels a task.
+ *
+ * @details A queued task is removed from the heap and its slot freed at once. A running
+ * task is only marked; the worker frees the slot when the callback returns, so the
+ * callback is never destroyed while it executes.
+ * @param[in] handle The handle returned by `\`add_task()\``.
+ * @return `true` if the task was cancelled.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+bool StaticScheduler<MaxTasks, CallableSize>::cancel(TaskHandle handle) {
+    if (handle.slot >= MaxTasks) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    Slot& slot = slots_[handle.slot];
+    if (slot.generation != handle.generation) {
+        return false;
+    }
+    switch (slot.state) {
+    case SlotState::Queued:
+        heap_remove(slot.link);
+        release_slot(handle.slot);
+        return true;
+    case SlotState::Running:
+        slot.state = SlotState::Cancelled;
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @fn StaticScheduler::size() const
+ * @brief Returns the number of registered tasks.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+std::size_t StaticScheduler<MaxTasks, CallableSize>::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return task_count_;
+}
+
+/**
+ * @fn StaticScheduler::run()
+ * @brief The dispatch loop.
+ *
+ * @details Sleeps until the earliest release, pops the due slot and runs its callback
+ * with the mutex released. Afterwards the task is either re-queued one interval after
+ * its previous release or, if it was cancelled meanwhile, freed.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+void StaticScheduler<MaxTasks, CallableSize>::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        if (heap_size_ == 0) {
+            wakeup_.wait(lock);
+            continue;
+        }
+        const auto release = slots_[heap_[0]].release;
+        if (clock_type::now() < release) {
+            wakeup_.wait_until(lock, release);
+            continue;
+        }
+        const std::uint32_t index = heap_[0];
+        heap_remove(0);
+        Slot& slot = slots_[index];
+        slot.state = SlotState::Running;
+
+        lock.unlock();
+        slot.callback();
+        lock.lock();
+
+        if (slot.state == SlotState::Cancelled) {
+            release_slot(index);
+        } else {
+            slot.state = SlotState::Queued;
+            slot.release += slot.interval;
+            heap_push(index);
+        }
+    }
+}
+
+/**
+ * @fn StaticScheduler::release_slot(std::uint32_t index)
+ * @brief Destroys the callback, advances the generation and frees the slot.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+void StaticScheduler<MaxTasks, CallableSize>::release_slot(std::uint32_t index) {
+    Slot& slot = slots_[index];
+    slot.callback = nullptr;
+    slot.state = SlotState::Free;
+    ++slot.generation;
+    slot.link = free_head_;
+    free_head_ = index;
+    --task_count_;
+}
+
+/**
+ * @fn StaticScheduler::heap_push(std::uint32_t index)
+ * @brief Appends the slot and sifts it up.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+void StaticScheduler<MaxTasks, CallableSize>::heap_push(std::uint32_t index) {
+    heap_place(heap_size_, index);
+    sift_up(heap_size_++);
+}
+
+/**
+ * @fn StaticScheduler::heap_remove(std::uint32_t position)
+ * @brief Replaces the entry with the last one and restores the heap order.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+void StaticScheduler<MaxTasks, CallableSize>::heap_remove(std::uint32_t position) {
+    --heap_size_;
+    if (position == heap_size_) {
+        return;
+    }
+    heap_place(position, heap_[heap_size_]);
+    sift_down(position);
+    sift_up(position);
+}
+
+/**
+ * @fn StaticScheduler::sift_up(std::uint32_t position)
+ * @brief Restores the heap order towards the root.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+void StaticScheduler<MaxTasks, CallableSize>::sift_up(std::uint32_t position) {
+    const std::uint32_t index = heap_[position];
+    while (position > 0) {
+        const std::uint32_t parent = (position - 1) / 2;
+        if (slots_[heap_[parent]].release <= slots_[index].release) {
+            break;
+        }
+        heap_place(position, heap_[parent]);
+        position = parent;
+    }
+    heap_place(position, index);
+}
+
+/**
+ * @fn StaticScheduler::sift_down(std::uint32_t position)
+ * @brief Restores the heap order towards the leaves.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+void StaticScheduler<MaxTasks, CallableSize>::sift_down(std::uint32_t position) {
+    const std::uint32_t index = heap_[position];
+    for (;;) {
+        std::uint32_t child = 2 * position + 1;
+        if (child >= heap_size_) {
+            break;
+        }
+        if (child + 1 < heap_size_ && slots_[heap_[child + 1]].release < slots_[heap_[child]].release) {
+            ++child;
+        }
+        if (slots_[index].release <= slots_[heap_[child]].release) {
+            break;
+        }
+        heap_place(position, heap_[child]);
+        position = child;
+    }
+    heap_place(position, index);
+}
+
+/**
+ * @fn StaticScheduler::heap_place(std::uint32_t position, std::uint32_t index)
+ * @brief Stores a slot index in the heap and back-links the slot to its position.
+ */
+template <std::size_t MaxTasks, std::size_t CallableSize>
+void StaticScheduler<MaxTasks, CallableSize>::heap_place(std::uint32_t position, std::uint32_t index) {
+    heap_[position] = index;
+    slots_[index].link = position;
+}
+
+#endif // STATIC_SCHEDULER_HPP
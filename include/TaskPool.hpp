@@ -0,0 +1,292 @@
+#ifndef TASK_POOL_HPP
+#define TASK_POOL_HPP
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file
+ * @brief Header file for the TaskPool slab allocator and its standard allocator adaptor.
+ */
+
+/**
+ * @class TaskPool
+ * @brief A process-wide slab allocator for small scheduler objects, with per-thread caches.
+ *
+ * @details Requests of up to `\`max_block\`` bytes are rounded up to a multiple of 16 and
+ * served from one free list per size class. Each thread keeps its own free lists, so a
+ * steady stream of allocations and frees needs neither a lock nor the global heap. A
+ * thread whose list runs dry takes a batch of blocks from a shared depot under a mutex;
+ * a thread that accumulates too many returns a batch. The depot carves new 64 KiB slabs
+ * from `\`operator new\`` only when it is empty, and slabs are kept for reuse rather than
+ * returned. Blocks may be freed on any thread. Larger requests go to `\`operator new\``.
+ */
+class TaskPool {
+public:
+    static constexpr std::size_t max_block = 256;
+    /**< @brief The largest request served from the pool. */
+
+    /**
+     * @brief Allocates `\`size\`` bytes aligned to 16.
+     * @param[in] size The number of bytes.
+     * @return The block.
+     * @throws std::bad_alloc If a new slab cannot be allocated.
+     */
+    static void* allocate(std::size_t size);
+
+    /**
+     * @brief Returns a block to the calling thread's cache.
+     * @param[in] block The block from `\`allocate()\``.
+     * @param[in] size The size passed to `\`allocate()\``.
+     */
+    static void deallocate(void* block, std::size_t size) noexcept;
+
+private:
+    static constexpr std::size_t granularity_ = 16;
+    /**< @brief The size-class step and the block alignment. */
+    static constexpr std::size_t classes_ = max_block / granularity_;
+    /**< @brief The number of size classes. */
+    static constexpr std::size_t slab_bytes_ = 64 * 1024;
+    /**< @brief The size of a slab carved into blocks. */
+    static constexpr std::size_t batch_ = 32;
+    /**< @brief The number of blocks moved between a thread cache and the depot at once. */
+
+    /**
+     * @brief A free block, linked through its first word.
+     */
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    /**
+     * @brief The shared free lists behind the thread caches.
+     */
+    struct Depot {
+        std::mutex mutex;
+        /**< @brief Guards the lists. */
+        FreeBlock* lists[classes_] = {};
+        /**< @brief One free list per size class. */
+    };
+
+    /**
+     * @brief A thread's private free lists.
+     * @details Returns its blocks to the depot when the thread exits.
+     */
+    struct Cache {
+        FreeBlock* lists[classes_] = {};
+        /**< @brief One free list per size class. */
+        std::size_t counts[classes_] = {};
+        /**< @brief The length of each list. */
+        ~Cache();
+    };
+
+    /**
+     * @brief Returns the depot; it is never destroyed, so late thread exits can still use it.
+     */
+    static Depot& depot();
+
+    /**
+     * @brief Returns the calling thread's cache.
+     */
+    static Cache& cache();
+
+    /**
+     * @brief Moves up to `\`batch_\`` blocks of class `\`index\`` from the depot into `\`cache\``.
+     * @details Carves a new slab if the depot has none.
+     */
+    static void refill(Cache& cache, std::size_t index);
+
+    /**
+     * @brief Moves `\`count\`` blocks of class `\`index\`` from `\`cache\`` to the depot.
+     */
+    static void drain(Cache& cache, std::size_t index, std::size_t count) noexcept;
+};
+
+/**
+ * @class PoolAllocator
+ * @brief A stateless standard allocator drawing from `\`TaskPool\``.
+ *
+ * @details Usable with standard containers, `\`std::allocate_shared\`` and as the
+ * associated allocator of Boost.Asio handlers.
+ *
+ * @tparam T The value type.
+ */
+template <typename T>
+struct PoolAllocator {
+    using value_type = T;
+
+    PoolAllocator() noexcept = default;
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+    /**
+     * @brief Allocates storage for `\`count\`` objects.
+     */
+    T* allocate(std::size_t count) {
+        static_assert(alignof(T) <= 16, "PoolAllocator blocks are 16-byte aligned");
+        return static_cast<T*>(TaskPool::allocate(count * sizeof(T)));
+    }
+
+    /**
+     * @brief Releases storage from `\`allocate()\``.
+     */
+    void deallocate(T* pointer, std::size_t count) noexcept {
+        TaskPool::deallocate(pointer, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U>&) const noexcept { return false; }
+};
+
+/**
+ * @brief Wraps a function object so that Boost.Asio allocates its operation from `\`TaskPool\``.
+ *
+ * @details Asio looks up a handler's `\`allocator_type\`` and `\`get_allocator()\`` when it
+ * allocates the operation that carries the handler to the worker thread, both for
+ * posted functions and for completion handlers such as a timer wait.
+ *
+ * @tparam Function The wrapped function object.
+ */
+template <typename Function>
+struct PooledHandler {
+    using allocator_type = PoolAllocator<char>;
+
+    Function function;
+    /**< @brief The wrapped function object. */
+
+    allocator_type get_allocator() const noexcept { return allocator_type(); }
+
+    template <typename... Args>
+    void operator()(Args&&... args) { function(std::forward<Args>(args)...); }
+};
+
+/**
+ * @brief Creates a `\`PooledHandler\`` for `\`function\``.
+ */
+template <typename Function>
+PooledHandler<std::decay_t<Function>> pooled(Function&& function) {
+    return PooledHandler<std::decay_t<Function>>{std::forward<Function>(function)};
+}
+
+// TaskPool Implementation
+
+/**
+ * @fn TaskPool::allocate(std::size_t size)
+ * @brief Pops a block from the thread's list for the size class, refilling it if empty.
+ */
+inline void* TaskPool::allocate(std::size_t size) {
+    if (size > max_block) {
+        return ::operator new(size);
+    }
+    const std::size_t index = size == 0 ? 0 : (size - 1) / granularity_;
+    Cache& local = cache();
+    if (local.lists[index] == nullptr) {
+        refill(local, index);
+    }
+    FreeBlock* block = local.lists[index];
+    local.lists[index] = block->next;
+    --local.counts[index];
+    return block;
+}
+
+/**
+ * @fn TaskPool::deallocate(void* block, std::size_t size)
+ * @brief Pushes the block onto the thread's list; hands a batch to the depot if the list is long.
+ */
+inline void TaskPool::deallocate(void* block, std::size_t size) noexcept {
+    if (block == nullptr) {
+        return;
+    }
+    if (size > max_block) {
+        ::operator delete(block);
+        return;
+    }
+    const std::size_t index = size == 0 ? 0 : (size - 1) / granularity_;
+    Cache& local = cache();
+    FreeBlock* free_block = static_cast<FreeBlock*>(block);
+    free_block->next = local.lists[index];
+    local.lists[index] = free_block;
+    if (++local.counts[index] >= 4 * batch_) {
+        drain(local, index, 2 * batch_);
+    }
+}
+
+/**
+ * @fn TaskPool::depot()
+ * @brief Returns the depot, created on first use and intentionally leaked.
+ */
+inline TaskPool::Depot& TaskPool::depot() {
+    static Depot* instance = new Depot();
+    return *instance;
+}
+
+/**
+ * @fn TaskPool::cache()
+ * @brief Returns the calling thread's cache.
+ */
+inline TaskPool::Cache& TaskPool::cache() {
+    thread_local Cache instance;
+    return instance;
+}
+
+/**
+ * @fn TaskPool::refill(Cache& cache, std::size_t index)
+ * @brief Takes a batch from the depot or carves a new slab.
+ *
+ * @details A new slab is split into blocks of the class size; one batch goes to the
+ * calling thread and the rest to the depot.
+ */
+inline void TaskPool::refill(Cache& cache, std::size_t index) {
+    Depot& shared = depot();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    if (shared.lists[index] == nullptr) {
+        const std::size_t block_size = (index + 1) * granularity_;
+        char* slab = static_cast<char*>(::operator new(slab_bytes_));
+        for (std::size_t offset = 0; offset + block_size <= slab_bytes_; offset += block_size) {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + offset);
+            block->next = shared.lists[index];
+            shared.lists[index] = block;
+        }
+    }
+    for (std::size_t i = 0; i < batch_ && shared.lists[index] != nullptr; ++i) {
+        FreeBlock* block = shared.lists[index];
+        shared.lists[index] = block->next;
+        block->next = cache.lists[index];
+        cache.lists[index] = block;
+        ++cache.counts[index];
+    }
+}
+
+/**
+ * @fn TaskPool::drain(Cache& cache, std::size_t index, std::size_t count)
+ * @brief Moves blocks from the thread's list to the depot.
+ */
+inline void TaskPool::drain(Cache& cache, std::size_t index, std::size_t count) noexcept {
+    Depot& shared = depot();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    for (std::size_t i = 0; i < count && cache.lists[index] != nullptr; ++i) {
+        FreeBlock* block = cache.lists[index];
+        cache.lists[index] = block->next;
+        --cache.counts[index];
+        block->next = shared.lists[index];
+        shared.lists[index] = block;
+    }
+}
+
+/**
+ * @fn TaskPool::Cache::~Cache()
+ * @brief Returns all cached blocks to the depot when the thread exits.
+ */
+inline TaskPool::Cache::~Cache() {
+    for (std::size_t index = 0; index < classes_; ++index) {
+        TaskPool::drain(*this, index, counts[index]);
+    }
+}
+
+#endif // TASK_POOL_HPP
@@ -0,0 +1,502 @@
+#ifndef TICK_BROADCAST_HPP
+#define TICK_BROADCAST_HPP
+#include "PeriodicExecutor.hpp"
+#include <boost/thread.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <ctime>
+#endif
+
+/**
+ * @file
+ * @brief Header file for the TickBroadcaster and TickFollower classes (POSIX only).
+ */
+
+/**
+ * @brief The tick state shared between a broadcaster and its followers.
+ *
+ * @details Lives at the start of the broadcast file. Only the broadcaster writes the
+ * tick fields; followers write `\`waiters\`` only.
+ */
+struct TickBroadcastBlock {
+    char magic[8];
+    /**< @brief `\`PETICK01\``. */
+    std::int64_t interval_ns;
+    /**< @brief The tick period. */
+    std::atomic<std::uint64_t> sequence;
+    /**< @brief The number of ticks published so far. */
+    std::atomic<std::int64_t> tick_ns;
+    /**< @brief The `\`steady_clock\`` time of the latest tick. */
+    std::atomic<std::uint32_t> word;
+    /**< @brief The futex word: the low 32 bits of `\`sequence\``, bumped once more on close. */
+    std::atomic<std::uint32_t> waiters;
+    /**< @brief The number of followers blocked in the kernel; the broadcaster skips the wake-up if zero. */
+    std::atomic<std::uint32_t> closed;
+    /**< @brief Set when the broadcaster stops. */
+};
+
+namespace tick_broadcast_detail {
+
+/**
+ * @brief Blocks while `\`*word == expected\``, for at most `\`timeout\``.
+ *
+ * @details A process-shared futex wait on Linux (no `\`FUTEX_PRIVATE_FLAG\``, since the
+ * word is mapped into several processes). Elsewhere it sleeps briefly; callers re-check
+ * their condition either way.
+ */
+inline void wait_on(std::atomic<std::uint32_t>& word, std::uint32_t expected, std::chrono::nanoseconds timeout) {
+#if defined(__linux__)
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "futex word must be 32 bits");
+    struct timespec relative {};
+    relative.tv_sec = static_cast<time_t>(timeout.count() / 1000000000);
+    relative.tv_nsec = static_cast<long>(timeout.count() % 1000000000);
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected, &relative, nullptr, 0);
+#else
+    if (word.load(std::memory_order_acquire) == expected) {
+        std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(timeout, std::chrono::microseconds(200)));
+    }
+#endif
+}
+
+/**
+ * @brief Wakes every process and thread blocked on `\`word\``.
+ */
+inline void wake_all(std::atomic<std::uint32_t>& word) {
+#if defined(__linux__)
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+/**
+ * @brief Opens and maps a broadcast file; shared by both ends.
+ * @param[in] path The file.
+ * @param[in] create Whether to create the file and extend it to the block's size.
+ * @param[out] fd Receives the open descriptor.
+ * @return The mapped block.
+ * @throws std::system_error If the file cannot be opened, sized or mapped.
+ */
+inline TickBroadcastBlock* map_block(const std::string& path, bool create, int& fd) {
+    // Never truncate: followers of a previous broadcaster may still have the file mapped.
+    fd = ::open(path.c_str(), create ? O_RDWR | O_CREAT | O_CLOEXEC : O_RDWR | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "TickBroadcast: cannot open " + path);
+    }
+    struct stat status {};
+    if (::fstat(fd, &status) != 0 ||
+        (create && static_cast<std::size_t>(status.st_size) < sizeof(TickBroadcastBlock) &&
+         (::ftruncate(fd, sizeof(TickBroadcastBlock)) != 0 || ::fstat(fd, &status) != 0)) ||
+        static_cast<std::size_t>(status.st_size) < sizeof(TickBroadcastBlock)) {
+        const int error = errno != 0 ? errno : EINVAL;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "TickBroadcast: cannot size " + path);
+    }
+    void* memory = ::mmap(nullptr, sizeof(TickBroadcastBlock), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "TickBroadcast: cannot map " + path);
+    }
+    return static_cast<TickBroadcastBlock*>(memory);
+}
+
+/**
+ * @brief The expected `\`TickBroadcastBlock::magic\``.
+ */
+constexpr char magic[8] = {'P', 'E', 'T', 'I', 'C', 'K', '0', '1'};
+
+} // namespace tick_broadcast_detail
+
+/**
+ * @class TickBroadcaster
+ * @brief Owns the one kernel timer of a group of processes and publishes its ticks.
+ *
+ * @details Co-located processes that each run their own 1 ms executor multiply the
+ * timer wake-ups and drift apart. Instead, one process runs a `\`TickBroadcaster\``,
+ * whose `\`PeriodicExecutor\`` increments a tick sequence number in a shared file
+ * mapping on every deadline and, if any follower is blocked, wakes them all with a
+ * single `\`FUTEX_WAKE\``. `\`TickFollower\``s in other processes (or threads) thereby
+ * share one anti-drift timer and run in phase with each other.
+ *
+ * Put the file on a tmpfs such as `\`/dev/shm\``.
+ */
+class TickBroadcaster {
+public:
+    /**
+     * @brief Creates or reopens the broadcast file and maps it.
+     * @details A file left by an earlier broadcaster is taken over in place, so followers
+     * still attached to it keep a valid mapping and see the sequence continue.
+     * @param[in] path The file followers open.
+     * @throws std::system_error If the file cannot be created or mapped.
+     */
+    explicit TickBroadcaster(const std::string& path);
+
+    /**
+     * @brief Destructor for `TickBroadcaster`.
+     * @details Calls `\`stop()\``, which releases all followers, and unmaps the file.
+     */
+    ~TickBroadcaster();
+
+    /**
+     * @brief Starts publishing ticks.
+     * @param[in] interval The tick period.
+     * @param[in] callback Optionally runs in this process on every tick, after the publication.
+     * @return `true` if started, `false` if already running.
+     */
+    bool start(std::chrono::milliseconds interval, std::function<void()> callback = nullptr);
+
+    /**
+     * @brief Stops publishing and marks the broadcast closed, waking all followers.
+     */
+    void stop();
+
+    /**
+     * @brief Returns the number of ticks published so far.
+     */
+    std::uint64_t ticks() const;
+
+    // The mapping and the executor's callback are tied to this object.
+    TickBroadcaster(const TickBroadcaster&) = delete;
+    TickBroadcaster& operator=(const TickBroadcaster&) = delete;
+
+private:
+    /**
+     * @brief Publishes one tick. Runs on the executor's worker.
+     */
+    void publish();
+
+    int fd_;
+    /**< @brief The broadcast file. */
+    TickBroadcastBlock* block_;
+    /**< @brief The shared block. */
+    std::function<void()> callback_;
+    /**< @brief The optional local callback. */
+    bool running_ = false;
+    /**< @brief Whether `\`start()\`` has been called without a matching `\`stop()\``. */
+    PeriodicExecutor<> executor_;
+    /**< @brief The single timer; declared last so it stops before the mapping goes away. */
+};
+
+/**
+ * @class TickFollower
+ * @brief Waits for the ticks of a `\`TickBroadcaster\``, possibly in another process.
+ *
+ * @details `\`wait()\`` first spins for a configurable time, which keeps the wake-up
+ * latency of a follower that expects the tick soon at a few hundred nanoseconds, and
+ * then blocks on the shared futex word. `\`start()\`` runs a callback for every tick on
+ * a follower thread. Ticks that arrive while the callback runs are coalesced; the
+ * callback receives the sequence number, so gaps are visible.
+ */
+class TickFollower {
+public:
+    /**
+     * @brief Maps an existing broadcast file.
+     * @param[in] path The file created by the broadcaster.
+     * @throws std::system_error If the file cannot be opened or mapped.
+     * @throws std::runtime_error If the file is not a broadcast file.
+     */
+    explicit TickFollower(const std::string& path);
+
+    /**
+     * @brief Destructor for `TickFollower`.
+     * @details Calls `\`stop()\`` and unmaps the file.
+     */
+    ~TickFollower();
+
+    /**
+     * @brief Waits for a tick newer than `\`seen\``.
+     * @param[in,out] seen The last sequence number the caller has handled; updated to the newest.
+     * @param[in] timeout The longest time to wait.
+     * @param[in] spin The part of the wait spent spinning before blocking.
+     * @return `true` if a newer tick arrived; `false` on timeout or if the broadcaster stopped.
+     */
+    bool wait(std::uint64_t& seen, std::chrono::nanoseconds timeout,
+              std::chrono::nanoseconds spin = std::chrono::nanoseconds::zero());
+
+    /**
+     * @brief Starts a thread that calls `\`callback\`` with the sequence number of every tick.
+     * @param[in] callback The per-tick work.
+     * @param[in] spin The spin time passed to `\`wait()\``.
+     * @return `true` if started, `false` if already running.
+     */
+    bool start(std::function<void(std::uint64_t)> callback,
+               std::chrono::nanoseconds spin = std::chrono::nanoseconds::zero());
+
+    /**
+     * @brief Stops the follower thread.
+     */
+    void stop();
+
+    /**
+     * @brief Returns the latest published sequence number.
+     */
+    std::uint64_t sequence() const;
+
+    /**
+     * @brief Returns the broadcaster's tick period.
+     */
+    std::chrono::nanoseconds interval() const;
+
+    /**
+     * @brief Reports whether the broadcaster has stopped.
+     */
+    bool closed() const;
+
+    // The mapping and the follower thread are tied to this object.
+    TickFollower(const TickFollower&) = delete;
+    TickFollower& operator=(const TickFollower&) = delete;
+
+private:
+    int fd_;
+    /**< @brief The broadcast file. */
+    TickBroadcastBlock* block_;
+    /**< @brief The shared block. */
+    std::atomic<bool> stopping_{false};
+    /**< @brief Tells the follower thread to exit. */
+    boost::thread thread_;
+    /**< @brief Runs the callback loop while started. */
+};
+
+// TickBroadcaster Implementation
+
+/**
+ * @fn TickBroadcaster::TickBroadcaster(const std::string& path)
+ * @brief Creates the file and initializes the block; the magic is written last.
+ *
+ * @details If the block already carries the magic, it belongs to a previous broadcaster
+ * on the same file and is left as it is: the sequence, the futex word and the waiter
+ * count of blocked followers all stay valid for the next `\`start()\``.
+ */
+inline TickBroadcaster::TickBroadcaster(const std::string& path)
+    : block_(tick_broadcast_detail::map_block(path, true, fd_)) {
+    if (std::memcmp(block_->magic, tick_broadcast_detail::magic, sizeof(block_->magic)) == 0) {
+        return;
+    }
+    new (block_) TickBroadcastBlock;
+    block_->interval_ns = 0;
+    block_->sequence.store(0, std::memory_order_relaxed);
+    block_->tick_ns.store(0, std::memory_order_relaxed);
+    block_->word.store(0, std::memory_order_relaxed);
+    block_->waiters.store(0, std::memory_order_relaxed);
+    block_->closed.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(block_->magic, tick_broadcast_detail::magic, sizeof(block_->magic));
+}
+
+/**
+ * @fn TickBroadcaster::~TickBroadcaster()
+ * @brief Releases the followers and unmaps the file.
+ */
+inline TickBroadcaster::~TickBroadcaster() {
+    stop();
+    ::munmap(block_, sizeof(TickBroadcastBlock));
+    ::close(fd_);
+}
+
+/**
+ * @fn TickBroadcaster::start(std::chrono::milliseconds interval, std::function<void()> callback)
+ * @brief Reopens the broadcast and starts the executor.
+ */
+inline bool TickBroadcaster::start(std::chrono::milliseconds interval, std::function<void()> callback) {
+    if (running_) {
+        return false;
+    }
+    running_ = true;
+    callback_ = std::move(callback);
+    block_->interval_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+    block_->closed.store(0, std::memory_order_release);
+    return executor_.start(interval, [this]() { publish(); });
+}
+
+/**
+ * @fn TickBroadcaster::stop()
+ * @brief Stops the executor, then closes the broadcast.
+ *
+ * @details The futex word is bumped as well, so that followers blocked in the kernel
+ * return immediately instead of at their timeout.
+ */
+inline void TickBroadcaster::stop() {
+    executor_.stop();
+    running_ = false;
+    block_->closed.store(1, std::memory_order_release);
+    block_->word.fetch_add(1, std::memory_order_seq_cst);
+    tick_broadcast_detail::wake_all(block_->word);
+}
+
+/**
+ * @fn TickBroadcaster::publish()
+ * @brief Advances the sequence and wakes blocked followers.
+ *
+ * @details The futex word is stored and `\`waiters\`` is read with sequential
+ * consistency; together with the followers' sequentially consistent increment of
+ * `\`waiters\`` before `\`FUTEX_WAIT\``, either the broadcaster sees the waiter or the
+ * kernel sees the new word, so no wake-up is lost. Without blocked followers a tick
+ * costs no syscall beyond the timer itself.
+ */
+inline void TickBroadcaster::publish() {
+    const std::uint64_t sequence = block_->sequence.load(std::memory_order_relaxed) + 1;
+    block_->tick_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              std::chrono::steady_clock::now().time_since_epoch()).count(),
+                          std::memory_order_relaxed);
+    block_->sequence.store(sequence, std::memory_order_release);
+    block_->word.store(static_cast<std::uint32_t>(sequence), std::memory_order_seq_cst);
+    if (block_->waiters.load(std::memory_order_seq_cst) != 0) {
+        tick_broadcast_detail::wake_all(block_->word);
+    }
+    if (callback_) {
+        callback_();
+    }
+}
+
+/**
+ * @fn TickBroadcaster::ticks() const
+ * @brief Reads the shared sequence number.
+ */
+inline std::uint64_t TickBroadcaster::ticks() const {
+    return block_->sequence.load(std::memory_order_acquire);
+}
+
+// TickFollower Implementation
+
+/**
+ * @fn TickFollower::TickFollower(const std::string& path)
+ * @brief Maps the file and checks the magic.
+ */
+inline TickFollower::TickFollower(const std::string& path)
+    : block_(tick_broadcast_detail::map_block(path, false, fd_)) {
+    if (std::memcmp(block_->magic, tick_broadcast_detail::magic, sizeof(block_->magic)) != 0) {
+        ::munmap(block_, sizeof(TickBroadcastBlock));
+        ::close(fd_);
+        throw std::runtime_error("TickFollower: " + path + " is not a tick broadcast file");
+    }
+}
+
+/**
+ * @fn TickFollower::~TickFollower()
+ * @brief Stops the follower thread and unmaps the file.
+ */
+inline TickFollower::~TickFollower() {
+    stop();
+    ::munmap(block_, sizeof(TickBroadcastBlock));
+    ::close(fd_);
+}
+
+/**
+ * @fn TickFollower::wait(std::uint64_t& seen, std::chrono::nanoseconds timeout, std::chrono::nanoseconds spin)
+ * @brief Spins, then blocks on the futex word until the sequence moves past `\`seen\``.
+ *
+ * @details The futex word is read before the sequence is re-checked, so a tick that is
+ * published in between changes the word and makes `\`FUTEX_WAIT\`` return at once.
+ */
+inline bool TickFollower::wait(std::uint64_t& seen, std::chrono::nanoseconds timeout, std::chrono::nanoseconds spin) {
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + timeout;
+    const auto spin_end = start + std::min(spin, timeout);
+    for (;;) {
+        const std::uint32_t word = block_->word.load(std::memory_order_seq_cst);
+        const std::uint64_t sequence = block_->sequence.load(std::memory_order_acquire);
+        if (sequence != seen) {
+            seen = sequence;
+            return true;
+        }
+        if (block_->closed.load(std::memory_order_acquire) != 0 || stopping_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            return false;
+        }
+        if (now < spin_end) {
+            continue;
+        }
+        block_->waiters.fetch_add(1, std::memory_order_seq_cst);
+        tick_broadcast_detail::wait_on(block_->word, word, deadline - now);
+        block_->waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @fn TickFollower::start(std::function<void(std::uint64_t)> callback, std::chrono::nanoseconds spin)
+ * @brief Starts the follower thread at the current sequence number.
+ *
+ * @details The thread waits in slices of a few intervals so that `\`stop()\`` is noticed
+ * even if the broadcaster is gone. While the broadcast is closed it polls once per slice.
+ */
+inline bool TickFollower::start(std::function<void(std::uint64_t)> callback, std::chrono::nanoseconds spin) {
+    if (thread_.joinable()) {
+        return false;
+    }
+    stopping_.store(false, std::memory_order_relaxed);
+    thread_ = boost::thread([this, callback = std::move(callback), spin]() {
+        std::uint64_t seen = sequence();
+        const std::chrono::nanoseconds slice = std::max<std::chrono::nanoseconds>(4 * interval(), std::chrono::milliseconds(10));
+        while (!stopping_.load(std::memory_order_relaxed)) {
+            if (wait(seen, slice, spin)) {
+                callback(seen);
+            } else if (closed()) {
+                // Nothing to wait on until the broadcaster restarts.
+                std::this_thread::sleep_for(slice);
+            }
+        }
+    });
+    return true;
+}
+
+/**
+ * @fn TickFollower::stop()
+ * @brief Signals the follower thread and joins it.
+ *
+ * @details Bumping the shared futex word would wake the followers of other processes as
+ * well, so a blocked thread is left to notice the flag at the end of its wait slice.
+ */
+inline void TickFollower::stop() {
+    stopping_.store(true, std::memory_order_relaxed);
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+/**
+ * @fn TickFollower::sequence() const
+ * @brief Reads the shared sequence number.
+ */
+inline std::uint64_t TickFollower::sequence() const {
+    return block_->sequence.load(std::memory_order_acquire);
+}
+
+/**
+ * @fn TickFollower::interval() const
+ * @brief Reads the tick period; zero before the broadcaster has started.
+ */
+inline std::chrono::nanoseconds TickFollower::interval() const {
+    return std::chrono::nanoseconds(block_->interval_ns);
+}
+
+/**
+ * @fn TickFollower::closed() const
+ * @brief Reads the closed flag.
+ */
+inline bool TickFollower::closed() const {
+    return block_->closed.load(std::memory_order_acquire) != 0;
+}
+
+#endif // TICK_BROADCAST_HPP
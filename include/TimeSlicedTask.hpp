@@ -0,0 +1,321 @@
+#ifndef TIME_SLICED_TASK_HPP
+#define TIME_SLICED_TASK_HPP
+#include "PeriodicExecutor.hpp"
+#include <boost/context/fiber.hpp>
+#include <boost/context/protected_fixedsize_stack.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+/**
+ * @file
+ * @brief Header file for the TimeSlicedTask class.
+ */
+
+class TimeSlicedTask;
+
+/**
+ * @class TimeSlice
+ * @brief The view of the current tick's budget handed to a `\`TimeSlicedTask\`` body.
+ *
+ * @details The body calls `\`checkpoint()\`` between units of work. Once the budget of
+ * the current tick is used up, `\`checkpoint()\`` suspends the body's fiber and returns
+ * on the next tick, with a fresh budget, as if nothing had happened. Because the body
+ * runs on its own stack, checkpoints may be placed at any call depth.
+ */
+class TimeSlice {
+public:
+    /**
+     * @brief Reports whether the budget of the current tick is used up.
+     */
+    bool expired() const;
+
+    /**
+     * @brief Suspends the body until the next tick if the budget is used up.
+     */
+    void checkpoint();
+
+    /**
+     * @brief Suspends the body until the next tick unconditionally.
+     */
+    void yield();
+
+private:
+    friend class TimeSlicedTask;
+    explicit TimeSlice(TimeSlicedTask& task) : task_(task) {}
+
+    TimeSlicedTask& task_;
+    /**< @brief The task whose fiber this slice belongs to. */
+};
+
+/**
+ * @class TimeSlicedTask
+ * @brief Runs a long task incrementally, a bounded slice per periodic tick.
+ *
+ * @details Work such as an index rebuild or a cache sweep can take much longer than one
+ * tick. Instead of giving it a dedicated thread, its body runs on a stackful fiber
+ * (Boost.Context) that is resumed once per tick with a time budget; when the budget
+ * expires at a `\`TimeSlice::checkpoint()\``, the fiber yields back to the tick and
+ * continues where it left off on the next one. The tick therefore never runs much
+ * longer than the budget and other work sharing the thread is not starved.
+ *
+ * When the body returns, the next tick starts it again from the beginning, so a
+ * periodic sweep is expressed as a plain loop over the data. Ticks come either from
+ * an internal `\`PeriodicExecutor\`` (`\`start()\``), or from any other driver that calls
+ * `\`run_slice()\``, e.g. a `\`PeriodicScheduler\`` task. `\`run_slice()\`` must not be
+ * called concurrently.
+ *
+ * An exception that escapes the body ends that run of the body. `\`run_slice()\``
+ * rethrows it to an external driver; under `\`start()\`` it is stored for
+ * `\`last_error()\`` instead and the tick goes on with a fresh run.
+ */
+class TimeSlicedTask {
+public:
+    /**
+     * @brief The task body; it receives the slice used to yield.
+     */
+    using Body = std::function<void(TimeSlice&)>;
+
+    /**
+     * @brief Constructs an idle task.
+     * @param[in] budget The time the body may run per tick before it yields.
+     * @param[in] body The task body.
+     * @param[in] stack_size The size of the fiber stack; a guard page is added below it.
+     */
+    TimeSlicedTask(std::chrono::microseconds budget, Body body, std::size_t stack_size = 64 * 1024);
+
+    /**
+     * @brief Destructor for `TimeSlicedTask`.
+     * @details Stops the tick, then unwinds a suspended body so its destructors run.
+     */
+    ~TimeSlicedTask();
+
+    /**
+     * @brief Starts ticking the task with an internal `\`PeriodicExecutor\``.
+     * @details Exceptions from the body do not stop the tick; see `\`last_error()\``.
+     * @param[in] interval The period between slices.
+     * @return `true` if started, `false` if it was already running.
+     */
+    bool start(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Stops the internal tick; a suspended body stays suspended.
+     */
+    void stop();
+
+    /**
+     * @brief Runs the body for at most one budget.
+     *
+     * @details Resumes the suspended body, or starts it if it is not running, and returns
+     * when it yields or completes. An exception thrown by the body is rethrown here and
+     * ends that run of the body.
+     */
+    void run_slice();
+
+    /**
+     * @brief Returns the number of slices run so far.
+     */
+    std::uint64_t slices() const;
+
+    /**
+     * @brief Returns the number of times the body has run to completion.
+     */
+    std::uint64_t completed_runs() const;
+
+    /**
+     * @brief Returns the most recent exception from a body run ticked by `\`start()\``,
+     * or an empty pointer.
+     */
+    std::exception_ptr last_error() const;
+
+    // The fiber refers to the task, so it can be neither copied nor moved.
+    TimeSlicedTask(const TimeSlicedTask&) = delete;
+    TimeSlicedTask& operator=(const TimeSlicedTask&) = delete;
+
+private:
+    friend class TimeSlice;
+
+    /**
+     * @brief Switches from the body's fiber back to `\`run_slice()\``.
+     */
+    void suspend();
+
+    std::chrono::microseconds budget_;
+    /**< @brief The run time allowed per slice. */
+    Body body_;
+    /**< @brief The task body. */
+    std::size_t stack_size_;
+    /**< @brief The usable size of the fiber stack. */
+    boost::context::fiber fiber_;
+    /**< @brief The suspended body; empty when no run of the body is in progress. */
+    boost::context::fiber caller_;
+    /**< @brief Inside the fiber: the context of `\`run_slice()\`` to switch back to. */
+    std::chrono::steady_clock::time_point slice_end_;
+    /**< @brief When the current slice's budget expires. */
+    std::exception_ptr error_;
+    /**< @brief An exception that escaped the body, rethrown by `\`run_slice()\``. */
+    std::atomic<std::uint64_t> slices_{0};
+    /**< @brief Slices run so far; written only by the ticking thread. */
+    std::atomic<std::uint64_t> completed_runs_{0};
+    /**< @brief Completed runs of the body; written only by the ticking thread. */
+    mutable std::mutex error_mutex_;
+    /**< @brief Protects `\`last_error_\``. */
+    std::exception_ptr last_error_;
+    /**< @brief The most recent exception caught by the internal tick. */
+    PeriodicExecutor<> executor_;
+    /**< @brief The internal tick; declared last so it stops before the fiber is destroyed. */
+};
+
+// TimeSlice Implementation
+
+/**
+ * @fn TimeSlice::expired() const
+ * @brief Compares the current time with the end of the slice.
+ */
+inline bool TimeSlice::expired() const {
+    return std::chrono::steady_clock::now() >= task_.slice_end_;
+}
+
+/**
+ * @fn TimeSlice::checkpoint()
+ * @brief Yields if the budget is used up.
+ */
+inline void TimeSlice::checkpoint() {
+    if (expired()) {
+        task_.suspend();
+    }
+}
+
+/**
+ * @fn TimeSlice::yield()
+ * @brief Yields unconditionally.
+ */
+inline void TimeSlice::yield() {
+    task_.suspend();
+}
+
+// TimeSlicedTask Implementation
+
+/**
+ * @fn TimeSlicedTask::TimeSlicedTask(std::chrono::microseconds budget, Body body, std::size_t stack_size)
+ * @brief Constructs an idle task; the fiber is created on the first slice.
+ */
+inline TimeSlicedTask::TimeSlicedTask(std::chrono::microseconds budget, Body body, std::size_t stack_size)
+    : budget_(budget), body_(std::move(body)), stack_size_(stack_size) {}
+
+/**
+ * @fn TimeSlicedTask::~TimeSlicedTask()
+ * @brief Stops the tick before `\`fiber_\`` is destroyed.
+ *
+ * @details Destroying a suspended `\`boost::context::fiber\`` resumes it with a
+ * `\`forced_unwind\`` exception, which unwinds the body's stack on this thread.
+ */
+inline TimeSlicedTask::~TimeSlicedTask() {
+    stop();
+}
+
+/**
+ * @fn TimeSlicedTask::start(std::chrono::milliseconds interval)
+ * @brief Starts the internal executor with `\`run_slice()\`` as its callback.
+ *
+ * @details The callback catches what `\`run_slice()\`` rethrows, so an exception from the
+ * body cannot unwind the executor's worker and end the tick.
+ */
+inline bool TimeSlicedTask::start(std::chrono::milliseconds interval) {
+    return executor_.start(interval, [this]() {
+        try {
+            run_slice();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            last_error_ = std::current_exception();
+        }
+    });
+}
+
+/**
+ * @fn TimeSlicedTask::stop()
+ * @brief Stops the internal executor.
+ */
+inline void TimeSlicedTask::stop() {
+    executor_.stop();
+}
+
+/**
+ * @fn TimeSlicedTask::run_slice()
+ * @brief Resumes the body's fiber for one budget.
+ *
+ * @details A new fiber is created when no run is in progress. The fiber function
+ * catches everything but Boost.Context's own `\`forced_unwind\``, since an exception
+ * leaving a fiber would terminate the process. When the fiber function returns,
+ * `\`resume()\`` yields an empty fiber, which marks the run as complete.
+ */
+inline void TimeSlicedTask::run_slice() {
+    slice_end_ = std::chrono::steady_clock::now() + budget_;
+    if (!fiber_) {
+        fiber_ = boost::context::fiber(
+            std::allocator_arg, boost::context::protected_fixedsize_stack(stack_size_),
+            [this](boost::context::fiber&& caller) {
+                caller_ = std::move(caller);
+                try {
+                    TimeSlice slice(*this);
+                    body_(slice);
+                } catch (const boost::context::detail::forced_unwind&) {
+                    throw;
+                } catch (...) {
+                    error_ = std::current_exception();
+                }
+                return std::move(caller_);
+            });
+    }
+    fiber_ = std::move(fiber_).resume();
+    slices_.store(slices_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (!fiber_) {
+        if (error_) {
+            std::exception_ptr error = std::move(error_);
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+        completed_runs_.store(completed_runs_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @fn TimeSlicedTask::suspend()
+ * @brief Switches back to `\`run_slice()\``; returns when the next slice resumes the fiber.
+ */
+inline void TimeSlicedTask::suspend() {
+    caller_ = std::move(caller_).resume();
+}
+
+/**
+ * @fn TimeSlicedTask::slices() const
+ * @brief Reads the slice counter.
+ */
+inline std::uint64_t TimeSlicedTask::slices() const {
+    return slices_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @fn TimeSlicedTask::completed_runs() const
+ * @brief Reads the completion counter.
+ */
+inline std::uint64_t TimeSlicedTask::completed_runs() const {
+    return completed_runs_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @fn TimeSlicedTask::last_error() const
+ * @brief Reads the most recent error of the internal tick.
+ */
+inline std::exception_ptr TimeSlicedTask::last_error() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return last_error_;
+}
+
+#endif // TIME_SLICED_TASK_HPP
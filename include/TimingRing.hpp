@@ -0,0 +1,517 @@
+#ifndef TIMING_RING_HPP
+#define TIMING_RING_HPP
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file
+ * @brief Header file for the TimingRing and TimingRingFile classes.
+ *
+ * @details Binary layout of a timing ring (all fields native-endian, version 1):
+ *
+ * | Offset | Size | Field                                                        |
+ * |--------|------|--------------------------------------------------------------|
+ * | 0      | 8    | magic, the bytes `\`PETRING1\``                              |
+ * | 8      | 4    | layout version, `\`1\``                                      |
+ * | 12     | 4    | header size in bytes, `\`64\``                               |
+ * | 16     | 4    | slot size in bytes, `\`40\``                                 |
+ * | 20     | 4    | capacity in slots, a power of two                            |
+ * | 24     | 8    | records written so far (atomic, release-stored per record)   |
+ * | 32     | 32   | reserved, zero                                               |
+ *
+ * Record `\`n\`` lives in slot `\`n % capacity\``, which starts at
+ * `\`64 + slot * 40\``. A slot holds an atomic 8-byte sequence number followed by a
+ * `\`TimingRecord\``: `\`2n + 1\`` while record `\`n\`` is being written and `\`2n + 2\``
+ * once it is complete. A reader copies the record and accepts it if the sequence number
+ * was `\`2n + 2\`` both before and after the copy.
+ *
+ * Times are nanoseconds of `\`std::chrono::steady_clock\``, which on Linux is
+ * `\`CLOCK_MONOTONIC\``, so other processes on the same host can compare them with
+ * their own clock readings.
+ */
+
+/**
+ * @brief The timing of one periodic execution.
+ */
+struct TimingRecord {
+    static constexpr std::uint32_t Late = 1u << 0;
+    /**< @brief Flag: the wake-up came more than one interval after the deadline. */
+    static constexpr std::uint32_t Overrun = 1u << 1;
+    /**< @brief Flag: the callback ran longer than one interval. */
+
+    std::int64_t deadline_ns;
+    /**< @brief The time the timer was armed for, jitter included. */
+    std::int64_t wake_ns;
+    /**< @brief The time the handler started. */
+    std::int64_t duration_ns;
+    /**< @brief The running time of the callback. */
+    std::uint32_t flags;
+    /**< @brief A combination of `\`Late\`` and `\`Overrun\``. */
+    std::uint32_t reserved;
+    /**< @brief Zero. */
+};
+
+/**
+ * @class TimingRing
+ * @brief A single-writer ring of timing records in a caller-provided memory block.
+ *
+ * @details The ring only touches the memory it is given, so writing a record is a few
+ * plain and atomic stores: no syscall, lock or allocation. Placed in a shared file
+ * mapping (see `\`TimingRingFile\``), it lets monitoring processes follow the timing of
+ * a live executor. The writer never waits for readers; a reader that falls more than
+ * `\`capacity\`` records behind loses the overwritten records and is told how many.
+ */
+class TimingRing {
+public:
+    /**
+     * @brief Returns the size of a memory block holding `\`capacity\`` records.
+     * @param[in] capacity The number of slots, rounded up to a power of two.
+     */
+    static std::size_t bytes_for(std::uint32_t capacity);
+
+    /**
+     * @brief Initializes an empty ring in `\`memory\``.
+     * @param[in] memory A block of at least `\`bytes_for(capacity)\`` bytes, aligned to 8 bytes.
+     * @param[in] capacity The number of slots, rounded up to a power of two.
+     * @return The ring, ready for `\`record()\``.
+     */
+    static TimingRing create(void* memory, std::uint32_t capacity);
+
+    /**
+     * @brief Attaches to a ring initialized by `\`create()\``, possibly in another process.
+     * @param[in] memory The start of the block.
+     * @param[in] bytes The size of the block.
+     * @return The ring, ready for `\`read()\``.
+     * @throws std::runtime_error If the header is not a valid version 1 header or does
+     * not fit into `\`bytes\``.
+     */
+    static TimingRing attach(void* memory, std::size_t bytes);
+
+    /**
+     * @brief Appends a record. Only one thread may write.
+     * @param[in] record The record to append.
+     */
+    void record(const TimingRecord& record);
+
+    /**
+     * @brief Copies the records written since `\`next\``.
+     *
+     * @details Safe against a concurrent writer in the same or another process.
+     *
+     * @param[in,out] next The number of the first record wanted; advanced past the last
+     * record copied. Start with `\`0\``, or with `\`written()\`` to skip the history.
+     * @param[out] out The records are appended to it.
+     * @return The number of wanted records that had already been overwritten.
+     */
+    std::uint64_t read(std::uint64_t& next, std::vector<TimingRecord>& out) const;
+
+    /**
+     * @brief Returns the number of records written so far.
+     */
+    std::uint64_t written() const;
+
+    /**
+     * @brief Returns the number of slots.
+     */
+    std::uint32_t capacity() const;
+
+private:
+    friend class TimingRingFile;
+
+    /**
+     * @brief The 64-byte header at the start of the block.
+     */
+    struct Header {
+        char magic[8];
+        /**< @brief `\`PETRING1\``. */
+        std::uint32_t version;
+        /**< @brief The layout version. */
+        std::uint32_t header_size;
+        /**< @brief `\`sizeof(Header)\``. */
+        std::uint32_t slot_size;
+        /**< @brief `\`sizeof(Slot)\``. */
+        std::uint32_t capacity;
+        /**< @brief The number of slots, a power of two. */
+        std::atomic<std::uint64_t> written;
+        /**< @brief The number of complete records. */
+        std::uint64_t reserved[4];
+        /**< @brief Zero. */
+    };
+
+    /**
+     * @brief One record and the sequence number that guards it.
+     */
+    struct Slot {
+        std::atomic<std::uint64_t> sequence;
+        /**< @brief Odd while being written; `\`2n + 2\`` once record `\`n\`` is complete. */
+        TimingRecord record;
+        /**< @brief The record. */
+    };
+
+    static_assert(sizeof(TimingRecord) == 32, "TimingRecord layout changed");
+    static_assert(sizeof(Header) == 64, "TimingRing header layout changed");
+    static_assert(sizeof(Slot) == 40, "TimingRing slot layout changed");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "TimingRing needs address-free 64-bit atomics to work across processes");
+
+    static constexpr char magic_[8] = {'P', 'E', 'T', 'R', 'I', 'N', 'G', '1'};
+    /**< @brief The expected header magic. */
+    static constexpr std::uint32_t version_ = 1;
+    /**< @brief The layout version written and accepted. */
+
+    TimingRing(Header* header, Slot* slots);
+
+    Header* header_;
+    /**< @brief The header inside the block. */
+    Slot* slots_;
+    /**< @brief The first slot, directly after the header. */
+    std::uint64_t mask_;
+    /**< @brief `\`capacity - 1\``. */
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * @class TimingRingFile
+ * @brief A `\`TimingRing\`` in a shared file mapping (POSIX only).
+ *
+ * @details The writing process creates the file with the capacity constructor and
+ * hands `\`ring()\`` to `\`PeriodicExecutor::set_timing_ring()\``; readers, typically
+ * other processes, open it with the path-only constructor. Pages written by the
+ * executor become visible to readers through the shared page cache, without any
+ * syscall on the hot path. Placing the file on a tmpfs such as `\`/dev/shm\`` avoids
+ * write-back to disk.
+ *
+ * A restarted writer never truncates the file, since readers of the previous writer
+ * may still have it mapped and would fault on the cut-off pages. A valid ring of the
+ * same capacity is taken over and continues after its last record; anything else is
+ * re-initialized in place, and its readers should reopen the file.
+ */
+class TimingRingFile {
+public:
+    /**
+     * @brief Creates `\`path\`` or takes it over, and maps the ring for writing.
+     *
+     * @details An existing ring with the same capacity keeps its records. Otherwise the
+     * ring is initialized empty; the file is grown if needed but never shrunk.
+     *
+     * @param[in] path The file to create or take over.
+     * @param[in] capacity The number of slots, rounded up to a power of two.
+     * @throws std::system_error If the file cannot be created, sized or mapped.
+     */
+    TimingRingFile(const std::string& path, std::uint32_t capacity);
+
+    /**
+     * @brief Maps an existing ring file for reading.
+     * @param[in] path The file to open.
+     * @throws std::system_error If the file cannot be opened or mapped.
+     * @throws std::runtime_error If the file does not hold a valid ring.
+     */
+    explicit TimingRingFile(const std::string& path);
+
+    /**
+     * @brief Destructor for `TimingRingFile`.
+     * @details Unmaps the file; the file itself stays for late readers.
+     */
+    ~TimingRingFile();
+
+    /**
+     * @brief Returns the mapped ring.
+     */
+    TimingRing& ring();
+
+    // The ring points into the mapping owned by this object.
+    TimingRingFile(const TimingRingFile&) = delete;
+    TimingRingFile& operator=(const TimingRingFile&) = delete;
+
+private:
+    /**
+     * @brief Maps `\`bytes\`` of `\`fd_\``.
+     * @param[in] bytes The size of the mapping.
+     * @param[in] writable Whether the mapping is writable.
+     * @param[in] path The path, for the error message.
+     */
+    void map(std::size_t bytes, bool writable, const std::string& path);
+
+    /**
+     * @brief Closes the file and throws the current `\`errno\``.
+     * @param[in] what Describes the failed operation.
+     */
+    [[noreturn]] void fail(const std::string& what);
+
+    int fd_ = -1;
+    /**< @brief The ring file. */
+    void* memory_ = nullptr;
+    /**< @brief The start of the mapping. */
+    std::size_t bytes_ = 0;
+    /**< @brief The size of the mapping. */
+    TimingRing ring_;
+    /**< @brief The ring inside the mapping. */
+};
+#endif
+
+// TimingRing Implementation
+
+/**
+ * @fn TimingRing::TimingRing(Header* header, Slot* slots)
+ * @brief Wraps an initialized block.
+ */
+inline TimingRing::TimingRing(Header* header, Slot* slots)
+    : header_(header), slots_(slots), mask_(header != nullptr ? header->capacity - 1 : 0) {}
+
+/**
+ * @fn TimingRing::bytes_for(std::uint32_t capacity)
+ * @brief Header plus one slot per record.
+ */
+inline std::size_t TimingRing::bytes_for(std::uint32_t capacity) {
+    std::uint32_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    return sizeof(Header) + static_cast<std::size_t>(rounded) * sizeof(Slot);
+}
+
+/**
+ * @fn TimingRing::create(void* memory, std::uint32_t capacity)
+ * @brief Constructs the header and slots in place.
+ *
+ * @details The record count is stored last with release semantics, after all other
+ * fields, so a reader that attaches early sees either a zeroed or a complete header.
+ */
+inline TimingRing TimingRing::create(void* memory, std::uint32_t capacity) {
+    std::uint32_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    Header* header = new (memory) Header;
+    std::memcpy(header->magic, magic_, sizeof(magic_));
+    header->version = version_;
+    header->header_size = sizeof(Header);
+    header->slot_size = sizeof(Slot);
+    header->capacity = rounded;
+    std::memset(header->reserved, 0, sizeof(header->reserved));
+    Slot* slots = reinterpret_cast<Slot*>(static_cast<char*>(memory) + sizeof(Header));
+    for (std::uint32_t i = 0; i < rounded; ++i) {
+        Slot* slot = new (&slots[i]) Slot;
+        slot->sequence.store(0, std::memory_order_relaxed);
+        slot->record = TimingRecord{};
+    }
+    header->written.store(0, std::memory_order_release);
+    return TimingRing(header, slots);
+}
+
+/**
+ * @fn TimingRing::attach(void* memory, std::size_t bytes)
+ * @brief Validates the header and wraps the block.
+ */
+inline TimingRing TimingRing::attach(void* memory, std::size_t bytes) {
+    if (bytes < sizeof(Header)) {
+        throw std::runtime_error("TimingRing: block too small for the header");
+    }
+    Header* header = static_cast<Header*>(memory);
+    if (std::memcmp(header->magic, magic_, sizeof(magic_)) != 0 || header->version != version_ ||
+        header->header_size != sizeof(Header) || header->slot_size != sizeof(Slot)) {
+        throw std::runtime_error("TimingRing: not a version 1 timing ring");
+    }
+    const std::uint32_t capacity = header->capacity;
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0 || bytes < bytes_for(capacity)) {
+        throw std::runtime_error("TimingRing: capacity does not match the block");
+    }
+    return TimingRing(header, reinterpret_cast<Slot*>(static_cast<char*>(memory) + sizeof(Header)));
+}
+
+/**
+ * @fn TimingRing::record(const TimingRecord& record)
+ * @brief The sequence-lock write side, one lock per slot.
+ *
+ * @details The release fence keeps the record stores from being reordered before the
+ * odd sequence number; the release stores of the final sequence number and the count
+ * publish the record.
+ */
+inline void TimingRing::record(const TimingRecord& record) {
+    const std::uint64_t n = header_->written.load(std::memory_order_relaxed);
+    Slot& slot = slots_[n & mask_];
+    slot.sequence.store(2 * n + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record = record;
+    slot.sequence.store(2 * n + 2, std::memory_order_release);
+    header_->written.store(n + 1, std::memory_order_release);
+}
+
+/**
+ * @fn TimingRing::read(std::uint64_t& next, std::vector<TimingRecord>& out) const
+ * @brief The sequence-lock read side.
+ *
+ * @details Records older than the last `\`capacity\`` are skipped up front. A record
+ * whose slot is overwritten during the copy is counted as lost as well; reading stops
+ * at the first record that is not complete yet.
+ */
+inline std::uint64_t TimingRing::read(std::uint64_t& next, std::vector<TimingRecord>& out) const {
+    const std::uint64_t written = header_->written.load(std::memory_order_acquire);
+    std::uint64_t lost = 0;
+    if (written > next + mask_ + 1) {
+        lost = written - (mask_ + 1) - next;
+        next = written - (mask_ + 1);
+    }
+    while (next < written) {
+        const Slot& slot = slots_[next & mask_];
+        const std::uint64_t expected = 2 * next + 2;
+        const std::uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before == expected) {
+            const TimingRecord copy = slot.record;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) == expected) {
+                out.push_back(copy);
+                ++next;
+                continue;
+            }
+        }
+        if (before < expected) {
+            break;
+        }
+        ++lost;
+        ++next;
+    }
+    return lost;
+}
+
+/**
+ * @fn TimingRing::written() const
+ * @brief Reads the record count.
+ */
+inline std::uint64_t TimingRing::written() const {
+    return header_->written.load(std::memory_order_acquire);
+}
+
+/**
+ * @fn TimingRing::capacity() const
+ * @brief Reads the capacity from the header.
+ */
+inline std::uint32_t TimingRing::capacity() const {
+    return static_cast<std::uint32_t>(mask_ + 1);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+// TimingRingFile Implementation
+
+/**
+ * @fn TimingRingFile::TimingRingFile(const std::string& path, std::uint32_t capacity)
+ * @brief Opens or creates the file, grows and maps it, then takes over or initializes the ring.
+ *
+ * @details Mirrors `\`TickBroadcaster\``: no `\`O_TRUNC\``, and `\`ftruncate()\`` only grows
+ * the file, so the pages mapped by earlier readers stay backed. The existing header is
+ * validated with `\`attach()\`` before it is trusted.
+ */
+inline TimingRingFile::TimingRingFile(const std::string& path, std::uint32_t capacity) : ring_(nullptr, nullptr) {
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        fail("cannot create " + path);
+    }
+    const std::size_t bytes = TimingRing::bytes_for(capacity);
+    struct stat status {};
+    if (::fstat(fd_, &status) != 0) {
+        fail("cannot stat " + path);
+    }
+    if (static_cast<std::size_t>(status.st_size) < bytes && ::ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+        fail("cannot size " + path);
+    }
+    map(bytes, true, path);
+    try {
+        ring_ = TimingRing::attach(memory_, bytes_);
+        if (TimingRing::bytes_for(ring_.capacity()) == bytes) {
+            return;
+        }
+    } catch (const std::runtime_error&) {
+        // Not a ring of this layout yet; initialized below.
+    }
+    ring_ = TimingRing::create(memory_, capacity);
+}
+
+/**
+ * @fn TimingRingFile::TimingRingFile(const std::string& path)
+ * @brief Opens and maps the file read-only, then validates the ring.
+ */
+inline TimingRingFile::TimingRingFile(const std::string& path) : ring_(nullptr, nullptr) {
+    fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ < 0) {
+        fail("cannot open " + path);
+    }
+    struct stat status {};
+    if (::fstat(fd_, &status) != 0) {
+        fail("cannot stat " + path);
+    }
+    map(static_cast<std::size_t>(status.st_size), false, path);
+    try {
+        ring_ = TimingRing::attach(memory_, bytes_);
+    } catch (...) {
+        ::munmap(memory_, bytes_);
+        ::close(fd_);
+        throw;
+    }
+}
+
+/**
+ * @fn TimingRingFile::~TimingRingFile()
+ * @brief Unmaps and closes the file.
+ */
+inline TimingRingFile::~TimingRingFile() {
+    ::munmap(memory_, bytes_);
+    ::close(fd_);
+}
+
+/**
+ * @fn TimingRingFile::ring()
+ * @brief Returns the ring.
+ */
+inline TimingRing& TimingRingFile::ring() {
+    return ring_;
+}
+
+/**
+ * @fn TimingRingFile::map(std::size_t bytes, bool writable, const std::string& path)
+ * @brief Creates a shared mapping of the whole file.
+ *
+ * @details Read-only mappings are still `\`MAP_SHARED\``, so the reader sees the
+ * writer's stores as they happen.
+ */
+inline void TimingRingFile::map(std::size_t bytes, bool writable, const std::string& path) {
+    if (bytes == 0) {
+        errno = EINVAL;
+        fail("empty ring file " + path);
+    }
+    const int protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* memory = ::mmap(nullptr, bytes, protection, MAP_SHARED, fd_, 0);
+    if (memory == MAP_FAILED) {
+        fail("cannot map " + path);
+    }
+    memory_ = memory;
+    bytes_ = bytes;
+}
+
+/**
+ * @fn TimingRingFile::fail(const std::string& what)
+ * @brief Releases the descriptor and throws `\`std::system_error\``.
+ */
+inline void TimingRingFile::fail(const std::string& what) {
+    const int error = errno;
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+    throw std::system_error(error, std::generic_category(), "TimingRingFile: " + what);
+}
+#endif
+
+#endif // TIMING_RING_HPP
@@ -0,0 +1,224 @@
+#ifndef TOKEN_BUCKET_LIMITER_HPP
+#define TOKEN_BUCKET_LIMITER_HPP
+#include "PeriodicExecutor.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+/**
+ * @file
+ * @brief Header file for the TokenBucketLimiter class.
+ */
+
+/**
+ * @class TokenBucketLimiter
+ * @brief A set of token-bucket rate limiters refilled by one shared periodic tick.
+ *
+ * @details Instead of reading a clock on every request, all buckets are refilled from a
+ * single tick counter that a `\`PeriodicExecutor\`` advances once per interval. The tick
+ * itself only increments that counter, so its cost does not depend on the number of
+ * buckets. Each bucket remembers the tick at which it was last refilled and catches up
+ * lazily, in `\`try_acquire()\``, the next time it is touched; buckets that see no traffic
+ * cost nothing. Refill work is therefore proportional to the buckets that are actually
+ * used, and millions of idle tenants are free.
+ *
+ * A bucket's state is one 64-bit word holding the token count (low 24 bits) and the
+ * last refill tick (high 40 bits), updated with a compare-and-swap loop. `\`try_acquire()\``
+ * is lock-free and may be called from any thread. Tick differences are taken modulo
+ * 2^40, which is unambiguous for buckets idle less than about 17 years at a 1 ms tick.
+ */
+class TokenBucketLimiter {
+public:
+    /**
+     * @brief The largest supported bucket capacity.
+     */
+    static constexpr std::uint32_t max_capacity = (1u << 24) - 1;
+
+    /**
+     * @brief Constructs a limiter with `\`bucket_count\`` full buckets.
+     * @param[in] bucket_count The number of independent buckets, e.g. one per tenant.
+     * @param[in] capacity The maximum number of tokens a bucket can hold (burst size).
+     * @param[in] tokens_per_tick The number of tokens added to every bucket per tick.
+     * @throws std::invalid_argument If `\`capacity\`` exceeds `\`max_capacity\``.
+     */
+    TokenBucketLimiter(std::size_t bucket_count, std::uint32_t capacity, std::uint32_t tokens_per_tick);
+
+    /**
+     * @brief Starts the refill tick.
+     * @param[in] interval The period of the refill tick.
+     * @return `true` if the tick was started, `false` if it was already running.
+     */
+    bool start(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Stops the refill tick. Buckets keep their tokens.
+     */
+    void stop();
+
+    /**
+     * @brief Tries to take tokens from a bucket.
+     *
+     * @details Lock-free and safe to call from any thread. The bucket is first brought
+     * up to date with the ticks elapsed since it was last touched.
+     *
+     * @param[in] bucket The bucket index, `\`0 <= bucket < bucket_count\``.
+     * @param[in] tokens The number of tokens to take.
+     * @return `true` if the tokens were taken, `false` if the bucket holds too few.
+     */
+    bool try_acquire(std::size_t bucket, std::uint32_t tokens = 1);
+
+    /**
+     * @brief Returns the number of tokens a bucket would hold if touched now.
+     * @param[in] bucket The bucket index.
+     * @return The available tokens.
+     */
+    std::uint32_t available(std::size_t bucket) const;
+
+    /**
+     * @brief Returns the number of refill ticks since construction.
+     */
+    std::uint64_t ticks() const;
+
+private:
+    /**
+     * @brief Splits a bucket word and applies the refill for the ticks elapsed since.
+     * @param[in] state The packed bucket state.
+     * @param[in] now The current tick, as read by the caller.
+     * @param[out] stamp The tick to store with the refilled count.
+     * @return The refilled token count.
+     */
+    std::uint32_t refilled_tokens(std::uint64_t state, std::uint64_t now, std::uint64_t& stamp) const;
+
+    static constexpr unsigned token_bits = 24;
+    /**< @brief Width of the token count in a bucket word. */
+    static constexpr std::uint64_t token_mask = (std::uint64_t{1} << token_bits) - 1;
+    /**< @brief Mask selecting the token count in a bucket word. */
+    static constexpr std::uint64_t tick_mask = (std::uint64_t{1} << (64 - token_bits)) - 1;
+    /**< @brief Mask for the 40-bit tick stored in a bucket word. */
+
+    std::size_t bucket_count_;
+    /**< @brief The number of buckets. */
+    std::uint32_t capacity_;
+    /**< @brief The maximum tokens per bucket. */
+    std::uint32_t tokens_per_tick_;
+    /**< @brief Tokens added per tick. */
+    std::unique_ptr<std::atomic<std::uint64_t>[]> buckets_;
+    /**< @brief Packed bucket states: last refill tick (high bits) and tokens (low bits). */
+    std::atomic<std::uint64_t> tick_{0};
+    /**< @brief The shared refill tick, advanced by `\`executor_\``. */
+    PeriodicExecutor<> executor_;
+    /**< @brief Drives the refill tick; declared last so it stops before the buckets go away. */
+};
+
+// TokenBucketLimiter Implementation
+
+/**
+ * @fn TokenBucketLimiter::TokenBucketLimiter(std::size_t bucket_count, std::uint32_t capacity, std::uint32_t tokens_per_tick)
+ * @brief Allocates all buckets up front, full and stamped with tick 0.
+ */
+inline TokenBucketLimiter::TokenBucketLimiter(std::size_t bucket_count, std::uint32_t capacity,
+                                              std::uint32_t tokens_per_tick)
+    : bucket_count_(bucket_count),
+      capacity_(capacity),
+      tokens_per_tick_(tokens_per_tick),
+      buckets_(new std::atomic<std::uint64_t>[bucket_count]) {
+    if (capacity > max_capacity) {
+        throw std::invalid_argument("TokenBucketLimiter: capacity exceeds 24 bits");
+    }
+    for (std::size_t i = 0; i < bucket_count_; ++i) {
+        buckets_[i].store(capacity_, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @fn TokenBucketLimiter::start(std::chrono::milliseconds interval)
+ * @brief Starts the executor that advances the shared tick.
+ */
+inline bool TokenBucketLimiter::start(std::chrono::milliseconds interval) {
+    return executor_.start(interval, [this]() {
+        tick_.fetch_add(1, std::memory_order_release);
+    });
+}
+
+/**
+ * @fn TokenBucketLimiter::stop()
+ * @brief Stops the executor that advances the shared tick.
+ */
+inline void TokenBucketLimiter::stop() {
+    executor_.stop();
+}
+
+/**
+ * @fn TokenBucketLimiter::refilled_tokens(std::uint64_t state, std::uint64_t now, std::uint64_t& stamp) const
+ * @brief Applies the lazy refill to a bucket word.
+ *
+ * @details The elapsed tick count is computed modulo 2^40. A caller that read the tick
+ * just before it advanced can find a bucket already stamped with the newer tick; the
+ * difference then appears "negative" (above half the range), no ticks have elapsed
+ * and the newer stamp is kept. The result is capped at the capacity before the
+ * multiplication can overflow.
+ */
+inline std::uint32_t TokenBucketLimiter::refilled_tokens(std::uint64_t state, std::uint64_t now,
+                                                         std::uint64_t& stamp) const {
+    const std::uint64_t tokens = state & token_mask;
+    const std::uint64_t stored = state >> token_bits;
+    const std::uint64_t elapsed = (now - stored) & tick_mask;
+    if (elapsed == 0 || elapsed > tick_mask / 2) {
+        stamp = stored;
+        return static_cast<std::uint32_t>(tokens);
+    }
+    stamp = now & tick_mask;
+    if (tokens_per_tick_ == 0) {
+        return static_cast<std::uint32_t>(tokens);
+    }
+    if (elapsed >= (capacity_ - tokens + tokens_per_tick_ - 1) / tokens_per_tick_) {
+        return capacity_;
+    }
+    return static_cast<std::uint32_t>(tokens + elapsed * tokens_per_tick_);
+}
+
+/**
+ * @fn TokenBucketLimiter::try_acquire(std::size_t bucket, std::uint32_t tokens)
+ * @brief Takes tokens with a compare-and-swap loop.
+ *
+ * @details A failed attempt does not write the bucket, so rejected traffic causes no
+ * cache-line transfers beyond the initial load.
+ */
+inline bool TokenBucketLimiter::try_acquire(std::size_t bucket, std::uint32_t tokens) {
+    std::atomic<std::uint64_t>& word = buckets_[bucket];
+    const std::uint64_t now = tick_.load(std::memory_order_acquire);
+    std::uint64_t state = word.load(std::memory_order_relaxed);
+    for (;;) {
+        std::uint64_t stamp;
+        const std::uint32_t current = refilled_tokens(state, now, stamp);
+        if (current < tokens) {
+            return false;
+        }
+        const std::uint64_t next = (stamp << token_bits) | (current - tokens);
+        if (word.compare_exchange_weak(state, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+/**
+ * @fn TokenBucketLimiter::available(std::size_t bucket) const
+ * @brief Reads a bucket without modifying it.
+ */
+inline std::uint32_t TokenBucketLimiter::available(std::size_t bucket) const {
+    std::uint64_t stamp;
+    return refilled_tokens(buckets_[bucket].load(std::memory_order_acquire), tick_.load(std::memory_order_acquire), stamp);
+}
+
+/**
+ * @fn TokenBucketLimiter::ticks() const
+ * @brief Reads the shared tick counter.
+ */
+inline std::uint64_t TokenBucketLimiter::ticks() const {
+    return tick_.load(std::memory_order_acquire);
+}
+
+#endif // TOKEN_BUCKET_LIMITER_HPP
@@ -0,0 +1,503 @@
+#ifndef WATCHDOG_HPP
+#define WATCHDOG_HPP
+#include <boost/thread.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#if defined(__linux__)
+#include <csignal>
+#include <cstdlib>
+#include <execinfo.h>
+#include <pthread.h>
+#endif
+
+/**
+ * @file
+ * @brief Header file for the Watchdog class.
+ */
+
+/**
+ * @brief Describes a callback that has been running longer than its budget.
+ */
+struct StallReport {
+    std::string name;
+    /**< @brief The name under which the executor was registered. */
+    std::chrono::milliseconds running_for;
+    /**< @brief How long the callback had been running when the stall was detected. */
+    std::chrono::milliseconds budget;
+    /**< @brief The running time after which the callback counts as stalled. */
+    std::vector<std::string> stack;
+    /**< @brief The worker's symbolized stack, if stack capture is enabled and succeeded. */
+};
+
+/**
+ * @class Watchdog
+ * @brief Detects periodic callbacks that block for longer than a number of intervals.
+ *
+ * @details A single monitor thread serves any number of executors. Each executor owns a
+ * `\`Watchdog::Slot\`` and marks the start and end of every callback execution with two
+ * relaxed atomic stores; the monitor scans all slots once per scan interval and reports
+ * every execution that has exceeded its budget through the hook, exactly once per
+ * execution. The hook runs on the monitor thread.
+ *
+ * On Linux, `\`enable_stack_capture()\`` additionally interrupts a stalled worker with a
+ * signal whose handler records the worker's call stack, so the report shows where the
+ * callback is stuck. The handler and its buffer are process-wide, so only one watchdog
+ * at a time may enable stack capture, and only one capture is in flight at a time.
+ */
+class Watchdog {
+public:
+    /**
+     * @brief The function invoked for every detected stall.
+     */
+    using Hook = std::function<void(const StallReport&)>;
+
+    /**
+     * @brief The per-executor state shared between a worker and the monitor thread.
+     */
+    class Slot {
+    public:
+        /**
+         * @brief Constructs a slot.
+         * @param[in] name The name reported for this executor.
+         */
+        explicit Slot(std::string name);
+
+        /**
+         * @brief Marks the start of a callback execution. Called by the worker.
+         * @param[in] budget The running time after which the execution counts as stalled.
+         */
+        void begin(std::chrono::steady_clock::duration budget);
+
+        /**
+         * @brief Marks the end of a callback execution. Called by the worker.
+         */
+        void end();
+
+    private:
+        friend class Watchdog;
+
+        std::string name_;
+        /**< @brief The name reported for this executor. */
+        std::atomic<std::int64_t> started_{0};
+        /**< @brief Start of the running execution in steady-clock ticks; `\`0\`` while idle. */
+        std::atomic<std::int64_t> budget_{0};
+        /**< @brief The budget of the running execution in steady-clock ticks. */
+        std::int64_t reported_ = 0;
+        /**< @brief Monitor only: the start time of the last execution that was reported. */
+#if defined(__linux__)
+        std::atomic<pthread_t> thread_{};
+        /**< @brief The thread of the running execution, recorded by every `\`begin()\``. */
+        std::atomic<bool> has_thread_{false};
+        /**< @brief Set while `\`thread_\`` refers to a thread inside an execution. */
+        std::atomic<bool> capturing_{false};
+        /**< @brief Set by the monitor while it may signal `\`thread_\``; `\`end()\`` waits for it. */
+#endif
+    };
+
+    /**
+     * @brief Constructs a stopped watchdog.
+     * @param[in] hook The function invoked for every detected stall.
+     * @param[in] scan_interval How often the monitor thread checks all slots; this bounds
+     * the detection latency beyond the budget.
+     */
+    explicit Watchdog(Hook hook, std::chrono::milliseconds scan_interval = std::chrono::milliseconds(100));
+
+    /**
+     * @brief Destructor for `Watchdog`.
+     * @details Calls `\`stop()\`` to join the monitor thread.
+     */
+    ~Watchdog();
+
+    /**
+     * @brief Starts the monitor thread.
+     * @return `true` if started, `false` if it was already running.
+     */
+    bool start();
+
+    /**
+     * @brief Stops and joins the monitor thread.
+     * @details Can be called multiple times. Registered slots stay valid.
+     */
+    void stop();
+
+    /**
+     * @brief Registers a new slot.
+     *
+     * @details Safe to call from any thread. The watchdog only keeps a weak reference;
+     * the slot is unregistered when the last owner releases it.
+     *
+     * @param[in] name The name reported for the executor.
+     * @return The slot to be marked around each callback execution.
+     */
+    std::shared_ptr<Slot> watch(std::string name);
+
+    /**
+     * @brief Captures the worker's stack when a stall is reported.
+     *
+     * @details Installs a handler for `\`signal_number\``, which must not be used by the
+     * application for anything else. The handler only calls `\`backtrace()\``; symbols are
+     * resolved on the monitor thread. Link with `\`-rdynamic\`` to get function names.
+     * The capture state is process-wide: while one watchdog has stack capture enabled,
+     * the call fails on every other watchdog until the first one is destroyed.
+     *
+     * @param[in] signal_number The signal sent to a stalled worker.
+     * @return `true` if the handler was installed; `false` if it could not be installed,
+     * another watchdog owns stack capture, or on non-Linux systems.
+     */
+    bool enable_stack_capture(int signal_number = 0);
+
+    // The monitor thread holds a pointer to the watchdog.
+    Watchdog(const Watchdog&) = delete;
+    Watchdog& operator=(const Watchdog&) = delete;
+
+private:
+    /**
+     * @brief The monitor thread's loop.
+     */
+    void run();
+
+    /**
+     * @brief Checks every slot once and reports new stalls.
+     */
+    void scan();
+
+    /**
+     * @brief Interrupts a stalled worker and collects its stack.
+     * @param[in] slot The stalled slot.
+     * @return The symbolized frames; empty if capture is disabled or timed out.
+     */
+    std::vector<std::string> capture_stack(Slot& slot);
+
+#if defined(__linux__)
+    /**
+     * @brief The stack capture signal handler; runs on the stalled worker.
+     */
+    static void on_capture_signal(int);
+
+    static constexpr int max_frames = 64;
+    /**< @brief The depth of a captured stack. */
+    static inline void* frames_[max_frames];
+    /**< @brief The frames written by the signal handler. */
+    static inline std::atomic<int> frame_count_{0};
+    /**< @brief The number of valid entries in `\`frames_\``. */
+    static inline std::atomic<int> capture_state_{0};
+    /**< @brief 0 idle, 1 requested, 2 handler writing, 3 captured. */
+    static inline std::atomic<Watchdog*> capture_owner_{nullptr};
+    /**< @brief The watchdog that enabled stack capture and may use the state above. */
+#endif
+
+    Hook hook_;
+    /**< @brief Receives the stall reports. */
+    std::chrono::milliseconds scan_interval_;
+    /**< @brief The period of the monitor loop. */
+    int capture_signal_ = 0;
+    /**< @brief The stack capture signal; `\`0\`` if capture is disabled. */
+    std::mutex mutex_;
+    /**< @brief Protects `\`slots_\`` and `\`stopping_\``. */
+    std::condition_variable wake_;
+    /**< @brief Wakes the monitor thread early on `\`stop()\``. */
+    std::vector<std::weak_ptr<Slot>> slots_;
+    /**< @brief All registered slots; expired ones are pruned during the scan. */
+    bool stopping_ = false;
+    /**< @brief Tells the monitor thread to exit. */
+    boost::thread monitor_thread_;
+    /**< @brief The single monitor thread. */
+};
+
+// Watchdog Implementation
+
+/**
+ * @fn Watchdog::Slot::Slot(std::string name)
+ * @brief Constructs an idle slot.
+ * @param[in] name The name reported for this executor.
+ */
+inline Watchdog::Slot::Slot(std::string name) : name_(std::move(name)) {}
+
+/**
+ * @fn Watchdog::Slot::begin(std::chrono::steady_clock::duration budget)
+ * @brief Publishes the start time and budget of an execution.
+ *
+ * @details The budget is stored before the start time, which is published with release
+ * order, so the monitor never pairs a new start with a stale budget. The start time is
+ * forced to be non-zero because zero marks an idle slot. The calling thread is recorded
+ * every time: an executor gets a new worker thread on every `\`start()\``, and the thread
+ * of an earlier run may already have been joined.
+ * @param[in] budget The running time after which the execution counts as stalled.
+ */
+inline void Watchdog::Slot::begin(std::chrono::steady_clock::duration budget) {
+#if defined(__linux__)
+    thread_.store(pthread_self(), std::memory_order_relaxed);
+    has_thread_.store(true, std::memory_order_release);
+#endif
+    budget_.store(budget.count(), std::memory_order_relaxed);
+    const std::int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+    started_.store(now != 0 ? now : 1, std::memory_order_release);
+}
+
+/**
+ * @fn Watchdog::Slot::end()
+ * @brief Marks the slot idle.
+ *
+ * @details Also withdraws the thread, so a worker that exits after its last execution
+ * is never signalled. The monitor sets `\`capturing_\`` before it checks `\`has_thread_\``;
+ * with sequentially consistent accesses on both sides, either it sees the thread
+ * withdrawn or this function sees the flag and waits until `\`pthread_kill()\`` has
+ * returned. The worker can therefore not exit and be joined while it is being signalled.
+ */
+inline void Watchdog::Slot::end() {
+    started_.store(0, std::memory_order_relaxed);
+#if defined(__linux__)
+    has_thread_.store(false);
+    while (capturing_.load()) {
+        boost::this_thread::yield();
+    }
+#endif
+}
+
+/**
+ * @fn Watchdog::Watchdog(Hook hook, std::chrono::milliseconds scan_interval)
+ * @brief Constructs a stopped watchdog.
+ * @param[in] hook The function invoked for every detected stall.
+ * @param[in] scan_interval The period of the monitor loop.
+ */
+inline Watchdog::Watchdog(Hook hook, std::chrono::milliseconds scan_interval)
+    : hook_(std::move(hook)), scan_interval_(scan_interval) {}
+
+/**
+ * @fn Watchdog::~Watchdog()
+ * @brief Joins the monitor thread and gives up stack capture.
+ */
+inline Watchdog::~Watchdog() {
+    stop();
+#if defined(__linux__)
+    Watchdog* self = this;
+    capture_owner_.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+#endif
+}
+
+/**
+ * @fn Watchdog::start()
+ * @brief Launches the monitor thread.
+ * @return `true` if started; `false` if already running.
+ */
+inline bool Watchdog::start() {
+    if (monitor_thread_.joinable()) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = false;
+    }
+    monitor_thread_ = boost::thread([this]() { run(); });
+    return true;
+}
+
+/**
+ * @fn Watchdog::stop()
+ * @brief Wakes and joins the monitor thread.
+ */
+inline void Watchdog::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    if (monitor_thread_.joinable()) {
+        monitor_thread_.join();
+    }
+}
+
+/**
+ * @fn Watchdog::watch(std::string name)
+ * @brief Creates and registers a slot.
+ * @param[in] name The name reported for the executor.
+ * @return The new slot.
+ */
+inline std::shared_ptr<Watchdog::Slot> Watchdog::watch(std::string name) {
+    auto slot = std::make_shared<Slot>(std::move(name));
+    std::lock_guard<std::mutex> lock(mutex_);
+    slots_.push_back(slot);
+    return slot;
+}
+
+/**
+ * @fn Watchdog::enable_stack_capture(int signal_number)
+ * @brief Installs the stack capture signal handler.
+ *
+ * @details `\`backtrace()\`` loads its unwinder lazily, which is not safe inside a signal
+ * handler, so it is called once here first. A `\`signal_number\`` of `\`0\`` selects
+ * `\`SIGRTMIN + 4\``. Ownership of the process-wide capture state is claimed first and
+ * handed back if the handler cannot be installed.
+ * @param[in] signal_number The signal sent to a stalled worker.
+ * @return `true` if the handler was installed.
+ */
+inline bool Watchdog::enable_stack_capture(int signal_number) {
+#if defined(__linux__)
+    Watchdog* owner = nullptr;
+    const bool claimed = capture_owner_.compare_exchange_strong(owner, this, std::memory_order_acq_rel);
+    if (!claimed && owner != this) {
+        return false;
+    }
+    if (signal_number == 0) {
+        signal_number = SIGRTMIN + 4;
+    }
+    void* warm_up[1];
+    backtrace(warm_up, 1);
+
+    struct sigaction action {};
+    action.sa_handler = &Watchdog::on_capture_signal;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    if (sigaction(signal_number, &action, nullptr) != 0) {
+        if (claimed) {
+            capture_owner_.store(nullptr, std::memory_order_release);
+        }
+        return false;
+    }
+    capture_signal_ = signal_number;
+    return true;
+#else
+    (void)signal_number;
+    return false;
+#endif
+}
+
+#if defined(__linux__)
+/**
+ * @fn Watchdog::on_capture_signal(int)
+ * @brief Records the interrupted thread's stack if a capture was requested.
+ *
+ * @details Claims the request with a compare-and-swap, so a signal that arrives after
+ * the monitor gave up writes nothing.
+ */
+inline void Watchdog::on_capture_signal(int) {
+    int expected = 1;
+    if (!capture_state_.compare_exchange_strong(expected, 2, std::memory_order_acq_rel)) {
+        return;
+    }
+    frame_count_.store(backtrace(frames_, max_frames), std::memory_order_relaxed);
+    capture_state_.store(3, std::memory_order_release);
+}
+#endif
+
+/**
+ * @fn Watchdog::run()
+ * @brief Scans all slots once per scan interval until stopped.
+ */
+inline void Watchdog::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+        wake_.wait_for(lock, scan_interval_, [this]() { return stopping_; });
+        if (stopping_) {
+            break;
+        }
+        lock.unlock();
+        scan();
+        lock.lock();
+    }
+}
+
+/**
+ * @fn Watchdog::scan()
+ * @brief Checks every slot once.
+ *
+ * @details The live slots are copied out under the lock, so workers registering new
+ * executors are never blocked by a slow hook. An execution is reported once, when its
+ * running time first exceeds its budget; `\`reported_\`` remembers its start time.
+ */
+inline void Watchdog::scan() {
+    std::vector<std::shared_ptr<Slot>> live;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        slots_.erase(std::remove_if(slots_.begin(), slots_.end(), [&live](const std::weak_ptr<Slot>& weak) {
+            auto slot = weak.lock();
+            if (!slot) {
+                return true;
+            }
+            live.push_back(std::move(slot));
+            return false;
+        }), slots_.end());
+    }
+
+    const std::int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+    for (auto& slot : live) {
+        const std::int64_t started = slot->started_.load(std::memory_order_acquire);
+        if (started == 0 || started == slot->reported_) {
+            continue;
+        }
+        const std::chrono::steady_clock::duration budget(slot->budget_.load(std::memory_order_relaxed));
+        const std::chrono::steady_clock::duration running(now - started);
+        if (running <= budget) {
+            continue;
+        }
+        slot->reported_ = started;
+        StallReport report{slot->name_,
+                           std::chrono::duration_cast<std::chrono::milliseconds>(running),
+                           std::chrono::duration_cast<std::chrono::milliseconds>(budget),
+                           capture_stack(*slot)};
+        if (hook_) {
+            hook_(report);
+        }
+    }
+}
+
+/**
+ * @fn Watchdog::capture_stack(Slot& slot)
+ * @brief Signals the stalled worker and symbolizes the frames it recorded.
+ *
+ * @details The thread is only signalled while `\`capturing_\`` holds off `\`end()\``; see
+ * `\`Slot::end()\``. Waits up to one scan interval for the handler. On timeout the request
+ * is withdrawn; if the handler claimed it in the meantime, its write is waited for so the
+ * next capture starts from a clean state.
+ * @param[in] slot The stalled slot.
+ * @return The symbolized frames, or an empty vector.
+ */
+inline std::vector<std::string> Watchdog::capture_stack(Slot& slot) {
+    std::vector<std::string> stack;
+#if defined(__linux__)
+    if (capture_signal_ == 0) {
+        return stack;
+    }
+    slot.capturing_.store(true);
+    if (!slot.has_thread_.load()) {
+        slot.capturing_.store(false, std::memory_order_release);
+        return stack;
+    }
+    capture_state_.store(1, std::memory_order_release);
+    const int sent = pthread_kill(slot.thread_.load(std::memory_order_relaxed), capture_signal_);
+    slot.capturing_.store(false, std::memory_order_release);
+    if (sent != 0) {
+        capture_state_.store(0, std::memory_order_release);
+        return stack;
+    }
+    const auto give_up = std::chrono::steady_clock::now() + scan_interval_;
+    while (capture_state_.load(std::memory_order_acquire) != 3) {
+        if (std::chrono::steady_clock::now() >= give_up) {
+            int expected = 1;
+            if (capture_state_.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) {
+                return stack;
+            }
+        }
+        boost::this_thread::sleep_for(boost::chrono::microseconds(100));
+    }
+    const int count = frame_count_.load(std::memory_order_relaxed);
+    if (char** symbols = backtrace_symbols(frames_, count)) {
+        stack.assign(symbols, symbols + count);
+        std::free(symbols);
+    }
+    capture_state_.store(0, std::memory_order_release);
+#else
+    (void)slot;
+#endif
+    return stack;
+}
+
+#endif // WATCHDOG_HPP
@@ -0,0 +1,59 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @file
+ * @brief Replaces the global `\`operator new\`` for tests that check heap use.
+ *
+ * @details The replacement functions are defined here, so this header may be included
+ * by only one translation unit per test executable.
+ */
+
+/**
+ * @brief What the replaced `\`operator new\`` does with an allocation.
+ */
+enum class HeapMode {
+    Allowed, /**< @brief Allocate without counting. */
+    Counted, /**< @brief Allocate and count in `\`heap_allocations\``. */
+    Banned   /**< @brief Count in `\`heap_allocations\`` and throw `\`std::bad_alloc\``. */
+};
+
+/**
+ * @brief The switch the tests flip around the code under test.
+ */
+static std::atomic<HeapMode> heap_mode{HeapMode::Allowed};
+
+/**
+ * @brief Counts the allocations made or attempted while `\`heap_mode\`` was not `\`Allowed\``.
+ */
+static std::atomic<int> heap_allocations{0};
+
+/**
+ * @brief Replaces the global `\`operator new\`` with one that follows `\`heap_mode\``.
+ */
+void* operator new(std::size_t size) {
+    const HeapMode mode = heap_mode.load(std::memory_order_relaxed);
+    if (mode != HeapMode::Allowed) {
+        heap_allocations.fetch_add(1, std::memory_order_relaxed);
+        if (mode == HeapMode::Banned) {
+            throw std::bad_alloc();
+        }
+    }
+    if (void* memory = std::malloc(size != 0 ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+#endif // ALLOCATION_COUNTER_HPP
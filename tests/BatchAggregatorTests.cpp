@@ -0,0 +1,120 @@
+#define BOOST_TEST_MODULE BatchAggregatorTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "BatchAggregator.hpp" // Include the component under test
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup BatchAggregatorTestSuite BatchAggregator Unit Tests
+ * @brief Test cases for verifying time- and size-triggered batching.
+ * @{
+ */
+
+BOOST_AUTO_TEST_SUITE(BatchAggregatorTests)
+
+/**
+ * @brief Tests that a few items are delivered together by the periodic tick.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_TickFlushesPartialBatch) {
+    std::vector<std::size_t> sizes;
+    BatchAggregator<int> aggregator([&sizes](std::vector<int>& batch) { sizes.push_back(batch.size()); }, 100);
+    aggregator.start(20ms);
+
+    aggregator.append(1);
+    aggregator.append(2);
+    aggregator.append(3);
+    std::this_thread::sleep_for(50ms);
+
+    BOOST_CHECK_EQUAL(aggregator.items(), 3u);
+    BOOST_CHECK_EQUAL(aggregator.batches(), 1u);
+    aggregator.stop();
+    BOOST_REQUIRE_EQUAL(sizes.size(), 1u);
+    BOOST_CHECK_EQUAL(sizes[0], 3u);
+}
+
+/**
+ * @brief Tests many producers with size-triggered flushes.
+ *
+ * @details Every item must be delivered exactly once, no batch may exceed the limit
+ * and the number of sink calls must be far below the number of items.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_ManyProducers) {
+    const int producers = 8;
+    const int per_producer = 10000;
+    std::vector<int> seen(producers * per_producer, 0);
+    std::size_t largest = 0;
+    BatchAggregator<int> aggregator([&](std::vector<int>& batch) {
+        largest = std::max(largest, batch.size());
+        for (int item : batch) {
+            seen[item]++;
+        }
+    }, 256);
+    aggregator.start(5ms);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&aggregator, p, per_producer]() {
+            for (int i = 0; i < per_producer; ++i) {
+                aggregator.append(p * per_producer + i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    aggregator.stop();
+
+    BOOST_CHECK_EQUAL(aggregator.items(), static_cast<std::uint64_t>(producers * per_producer));
+    BOOST_CHECK_LE(largest, 256u);
+    BOOST_CHECK_LT(aggregator.batches(), static_cast<std::uint64_t>(producers * per_producer / 100));
+    std::size_t wrong = 0;
+    for (int count : seen) {
+        wrong += count != 1;
+    }
+    BOOST_CHECK_EQUAL(wrong, 0u);
+}
+
+/**
+ * @brief Tests that a producer thread drops its lookups of destroyed aggregators.
+ *
+ * @details A thread appends to many short-lived aggregators, one at a time. Its
+ * thread-local map must not keep an entry per aggregator it ever saw; after the next
+ * lookup miss it holds only the live ones, which still receive their items.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_DestroyedAggregatorsLeaveNoLookups) {
+    std::size_t before = 0;
+    std::size_t after = 0;
+    std::uint64_t delivered = 0;
+    std::thread producer([&]() {
+        BatchAggregator<int> first([](std::vector<int>&) {}, 16);
+        first.append(0);
+        for (int i = 0; i < 100; ++i) {
+            BatchAggregator<int> transient([](std::vector<int>&) {}, 16);
+            transient.append(i);
+            first.append(i);
+        }
+        before = BatchAggregator<int>::cached_buffers();
+        BatchAggregator<int> last([](std::vector<int>&) {}, 16);
+        last.append(0);
+        first.append(0);
+        after = BatchAggregator<int>::cached_buffers();
+        first.stop();
+        delivered = first.items();
+    });
+    producer.join();
+
+    BOOST_CHECK_LE(before, 3u);
+    BOOST_CHECK_EQUAL(after, 2u);
+    BOOST_CHECK_EQUAL(delivered, 102u);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // BatchAggregatorTests
+
+/** @} */
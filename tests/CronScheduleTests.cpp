@@ -0,0 +1,87 @@
+#define BOOST_TEST_MODULE CronScheduleTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "CronSchedule.hpp" // Include the component under test
+#include <chrono>
+#include <stdexcept>
+
+/**
+ * @defgroup CronTestSuite CronSchedule Unit Tests
+ * @brief Test cases for cron expression parsing and next-fire computation.
+ * @{
+ */
+
+/**
+ * @brief Builds a wall-clock time point from Unix seconds.
+ * @param[in] seconds Seconds since 1970-01-01 00:00:00 UTC.
+ * @return The corresponding `system_clock` time point.
+ */
+static CronSchedule::clock_type::time_point at(long long seconds) {
+    return CronSchedule::clock_type::time_point(std::chrono::seconds(seconds));
+}
+
+BOOST_AUTO_TEST_SUITE(CronScheduleTests)
+
+/**
+ * @brief Tests a stepped seconds field restricted to business hours.
+ *
+ * @details All reference times are on Saturday 2025-10-18 (UTC).
+ */
+BOOST_AUTO_TEST_CASE(Test_01_EveryFifteenSecondsDuringBusinessHours) {
+    const CronSchedule schedule("0/15 * 8-17 * * *");
+    BOOST_CHECK(schedule.next(at(1760774399)) == at(1760774400)); // 07:59:59 -> 08:00:00
+    BOOST_CHECK(schedule.next(at(1760774400)) == at(1760774415)); // 08:00:00 -> 08:00:15
+    BOOST_CHECK(schedule.next(at(1760810385)) == at(1760860800)); // 17:59:45 -> next day 08:00:00
+}
+
+/**
+ * @brief Tests the first second of each minute and sub-second reference times.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_FirstSecondOfEachMinute) {
+    const CronSchedule schedule("0 * * * * *");
+    BOOST_CHECK(schedule.next(at(1760790896)) == at(1760790900)); // 12:34:56 -> 12:35:00
+    BOOST_CHECK(schedule.next(at(1760790900) - std::chrono::milliseconds(1)) == at(1760790900));
+    BOOST_CHECK(schedule.next(at(1760790900)) == at(1760790960));
+}
+
+/**
+ * @brief Tests day-of-week, leap-day and year-rollover carries.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_CalendarCarries) {
+    // Mondays at midnight: Saturday 2025-10-18 -> Monday 2025-10-20.
+    BOOST_CHECK(CronSchedule("0 0 0 * * 1").next(at(1760790896)) == at(1760918400));
+    // Leap day: the next 29th of February is in 2028.
+    BOOST_CHECK(CronSchedule("0 0 0 29 2 *").next(at(1760790896)) == at(1835395200));
+    // New year: 2025-12-31 23:59:59 -> 2026-01-01 00:00:00.
+    BOOST_CHECK(CronSchedule("0 0 0 1 1 *").next(at(1767225599)) == at(1767225600));
+    // Both day fields restricted: the 1st or a Wednesday, whichever comes first.
+    BOOST_CHECK(CronSchedule("0 0 0 1 * 3").next(at(1760790896)) == at(1761091200));
+}
+
+/**
+ * @brief Tests a fixed UTC offset and a schedule that never fires.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_OffsetAndImpossibleSchedule) {
+    // 10:00 at UTC+1 is 09:00 UTC.
+    const CronSchedule schedule("0 0 10 * * *", std::chrono::minutes(60));
+    BOOST_CHECK(schedule.next(at(1760774400)) == at(1760778000));
+
+    BOOST_CHECK(CronSchedule("0 0 0 30 2 *").next(at(1760790896)) == CronSchedule::clock_type::time_point::max());
+}
+
+/**
+ * @brief Tests that malformed expressions are rejected.
+ */
+BOOST_AUTO_TEST_CASE(Test_05_InvalidExpressions) {
+    BOOST_CHECK_THROW(CronSchedule("* * *"), std::invalid_argument);
+    BOOST_CHECK_THROW(CronSchedule("60 * * * * *"), std::invalid_argument);
+    BOOST_CHECK_THROW(CronSchedule("a * * * * *"), std::invalid_argument);
+    BOOST_CHECK_THROW(CronSchedule("5-3 * * * * *"), std::invalid_argument);
+    BOOST_CHECK_THROW(CronSchedule("*/0 * * * * *"), std::invalid_argument);
+    BOOST_CHECK_THROW(CronSchedule("0 0 0 0 * *"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CronScheduleTests
+
+/** @} */
@@ -6,7 +6,15 @@
 #include <iostream>
 #include <thread>
 #include <chrono>
+#include <algorithm>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#if defined(__linux__)
+#include <dirent.h>
+#endif
 
 using namespace std::chrono_literals;
 
@@ -188,6 +196,486 @@ BOOST_AUTO_TEST_CASE(Test_04_IdempotencyAndSafety) {
     BOOST_CHECK_EQUAL(count.load(), count_after_stop);
 }
 
+/**
+ * @brief Tests that `ResumeMode::PreservePhase` keeps the original schedule grid.
+ *
+ * @details Pauses for an interval and a half so that a plain restart would shift
+ * the phase by half a period, then checks that the first execution after the resume
+ * still lands on the `start + k*interval` grid.
+ */
+BOOST_AUTO_TEST_CASE(Test_05_ResumePreservesPhase) {
+    PeriodicExecutor<> executor;
+    std::atomic<long long> last_offset_ms{0};
+    std::atomic<int> count{0};
+
+    const auto interval = 100ms;
+    const auto start_time = std::chrono::steady_clock::now();
+
+    executor.start(interval, [&]() {
+        last_offset_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_time).count();
+        count++;
+    });
+
+    std::this_thread::sleep_until(start_time + 250ms);
+    executor.pause();
+    std::this_thread::sleep_until(start_time + 450ms);
+    const int count_at_resume = count.load();
+    executor.resume(ResumeMode::PreservePhase);
+
+    // The next grid point is 500ms; a restart would have fired at 550ms.
+    std::this_thread::sleep_until(start_time + 530ms);
+    executor.stop();
+
+    BOOST_CHECK_EQUAL(count.load(), count_at_resume + 1);
+    BOOST_CHECK_GE(last_offset_ms.load(), 500);
+    BOOST_CHECK_LT(last_offset_ms.load(), 530);
+}
+
+/**
+ * @brief Tests that `ResumeMode::CatchUp` fires a missed deadline immediately.
+ *
+ * @details The deadlines at 300ms and 400ms fall inside the pause, so resuming
+ * at 450ms must execute the task at once and then continue at 500ms on the grid.
+ */
+BOOST_AUTO_TEST_CASE(Test_06_ResumeCatchUpFiresMissedDeadline) {
+    PeriodicExecutor<> executor;
+    std::vector<long long> offsets_ms;
+    std::mutex offsets_mutex;
+
+    const auto interval = 100ms;
+    const auto start_time = std::chrono::steady_clock::now();
+
+    executor.start(interval, [&]() {
+        std::lock_guard<std::mutex> lock(offsets_mutex);
+        offsets_ms.push_back(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_time).count());
+    });
+
+    std::this_thread::sleep_until(start_time + 250ms);
+    executor.pause();
+    std::this_thread::sleep_until(start_time + 450ms);
+    executor.resume(ResumeMode::CatchUp);
+    std::this_thread::sleep_until(start_time + 530ms);
+    executor.stop();
+
+    std::lock_guard<std::mutex> lock(offsets_mutex);
+    BOOST_REQUIRE_EQUAL(offsets_ms.size(), 4u);
+    BOOST_CHECK_LT(offsets_ms[2], 480);
+    BOOST_CHECK_GE(offsets_ms[3], 500);
+    BOOST_CHECK_LT(offsets_ms[3], 530);
+}
+
+/**
+ * @brief Tests that an adaptive poller backs off when idle and speeds up under load.
+ *
+ * @details Idle polls double the interval from 10ms up to the 80ms bound
+ * (10 + 20 + 40 + 80ms); polls that find work then step it back down by 10ms
+ * each to the 10ms bound. `stats()` must report the interval and rate.
+ */
+BOOST_AUTO_TEST_CASE(Test_07_AdaptiveIntervalFeedback) {
+    PeriodicExecutor<> executor;
+    std::atomic<bool> busy{false};
+
+    AdaptiveInterval config{10ms, 80ms, 2.0, 10ms};
+    executor.start(config, [&]() {
+        return busy ? PollResult::WorkFound : PollResult::Idle;
+    });
+
+    std::this_thread::sleep_for(400ms);
+    const ExecutorStats idle_stats = executor.stats();
+    BOOST_CHECK_EQUAL(idle_stats.current_interval.count(), 80);
+    BOOST_CHECK_CLOSE(idle_stats.effective_rate_hz, 12.5, 0.001);
+
+    busy = true;
+    // Up to 80ms until the next poll, then 70 + 60 + ... + 20ms until the interval is 10ms.
+    std::this_thread::sleep_for(500ms);
+    const ExecutorStats busy_stats = executor.stats();
+    executor.stop();
+
+    BOOST_CHECK_EQUAL(busy_stats.current_interval.count(), 10);
+    BOOST_CHECK_CLOSE(busy_stats.effective_rate_hz, 100.0, 0.001);
+    BOOST_CHECK_GT(busy_stats.tick_count, idle_stats.tick_count);
+}
+
+/**
+ * @brief Tests that jittered deadlines stay within bounds and do not drift.
+ *
+ * @details With a 50ms interval and up to 20ms of uniform jitter, the k-th execution
+ * must happen between the nominal deadline `(k+1)*50ms` and 20ms (plus tolerance)
+ * after it, so the average period stays 50ms. The offsets must actually vary.
+ */
+BOOST_AUTO_TEST_CASE(Test_08_JitterWithoutDrift) {
+    PeriodicExecutor<> executor;
+    std::vector<long long> offsets_us;
+    std::mutex offsets_mutex;
+
+    const auto interval = 50ms;
+    executor.set_jitter(JitterDistribution::Uniform, 20ms);
+    const auto start_time = std::chrono::steady_clock::now();
+
+    executor.start(interval, [&]() {
+        std::lock_guard<std::mutex> lock(offsets_mutex);
+        offsets_us.push_back(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start_time).count());
+    });
+
+    std::this_thread::sleep_for(1025ms);
+    executor.stop();
+
+    std::lock_guard<std::mutex> lock(offsets_mutex);
+    BOOST_REQUIRE_EQUAL(offsets_us.size(), 20u);
+    long long min_offset = offsets_us[0];
+    long long max_offset = offsets_us[0];
+    for (std::size_t k = 0; k < offsets_us.size(); ++k) {
+        const long long offset = offsets_us[k] - static_cast<long long>(k + 1) * 50000;
+        BOOST_CHECK_GE(offset, 0);
+        BOOST_CHECK_LT(offset, 20000 + 5000);
+        min_offset = k == 0 ? offset : std::min(min_offset, offset);
+        max_offset = k == 0 ? offset : std::max(max_offset, offset);
+    }
+    BOOST_CHECK_GT(max_offset - min_offset, 2000);
+}
+
+/**
+ * @brief Tests that bounded runs end by themselves.
+ *
+ * @details The run-count variant must execute exactly five times and report
+ * `finished()` without any call to `stop()`; the deadline variant must not execute
+ * deadlines after its end time.
+ */
+BOOST_AUTO_TEST_CASE(Test_09_BoundedRuns) {
+    PeriodicExecutor<> counted;
+    PeriodicExecutor<> timed;
+    std::atomic<int> counted_runs{0};
+    std::atomic<int> timed_runs{0};
+
+    counted.start(20ms, 5, [&]() { counted_runs++; });
+    // Deadlines at 30, 60 and 90ms lie before the end time; 120ms does not.
+    timed.start_until(30ms, boost::asio::steady_timer::clock_type::now() + 105ms, [&]() { timed_runs++; });
+
+    std::this_thread::sleep_for(250ms);
+    BOOST_CHECK(counted.finished());
+    BOOST_CHECK(timed.finished());
+    BOOST_CHECK_EQUAL(counted_runs.load(), 5);
+    BOOST_CHECK_EQUAL(timed_runs.load(), 3);
+    BOOST_CHECK_EQUAL(counted.stats().tick_count, 5u);
+    counted.stop();
+}
+
+/**
+ * @brief The minimal policy with missed deadlines skipped instead of caught up.
+ */
+struct SkipPolicies : MinimalExecutorPolicies {
+    static constexpr OverrunPolicy overrun = OverrunPolicy::Skip;
+};
+
+/**
+ * @brief Tests the minimal policy and the skipping overrun policy.
+ *
+ * @details The first execution of each executor blocks for 105ms on a 20ms grid. With
+ * `\`OverrunPolicy::CatchUp\`` the four deadlines missed meanwhile run back to back;
+ * with `\`OverrunPolicy::Skip\`` they are dropped and the next execution lies on the
+ * grid point after the overrun. The minimal policy stores the callback inline and has
+ * neither stats nor hooks.
+ */
+BOOST_AUTO_TEST_CASE(Test_10_Policies) {
+    PeriodicExecutor<boost::asio::io_context::executor_type, MinimalExecutorPolicies> catch_up;
+    PeriodicExecutor<boost::asio::io_context::executor_type, SkipPolicies> skip;
+    std::vector<std::chrono::steady_clock::time_point> catch_up_times;
+    std::vector<std::chrono::steady_clock::time_point> skip_times;
+    std::mutex times_mutex;
+
+    const auto recorder = [&times_mutex](std::vector<std::chrono::steady_clock::time_point>& times) {
+        return [&times_mutex, &times]() {
+            std::unique_lock<std::mutex> lock(times_mutex);
+            times.push_back(std::chrono::steady_clock::now());
+            if (times.size() == 1) {
+                lock.unlock();
+                std::this_thread::sleep_for(105ms);
+            }
+        };
+    };
+    catch_up.start(20ms, recorder(catch_up_times));
+    skip.start(20ms, recorder(skip_times));
+    std::this_thread::sleep_for(200ms);
+    catch_up.stop();
+    skip.stop();
+
+    std::lock_guard<std::mutex> lock(times_mutex);
+    BOOST_REQUIRE_GE(catch_up_times.size(), 6u);
+    BOOST_REQUIRE_GE(skip_times.size(), 3u);
+    // CatchUp: deadlines 40..100ms run right after the overrun ends at ~125ms.
+    BOOST_CHECK(catch_up_times[4] - catch_up_times[1] < 10ms);
+    // Skip: the next execution is the 140ms grid point, one interval after the next.
+    BOOST_CHECK(skip_times[1] - skip_times[0] >= 110ms);
+    BOOST_CHECK(skip_times[2] - skip_times[1] >= 15ms);
+    BOOST_CHECK_LE(skip_times.size(), 9u);
+}
+
+/**
+ * @brief Tests the strand-free single-threaded mode, including mailbox pause/resume.
+ *
+ * @details Pause and resume are applied by the worker; after `\`pause()\`` at most the
+ * execution already in flight may still happen, and `\`resume()\`` must restart ticking.
+ */
+BOOST_AUTO_TEST_CASE(Test_11_SingleThreaded) {
+    PeriodicExecutor<boost::asio::io_context::executor_type, SingleThreadedExecutorPolicies> executor;
+    std::atomic<int> count{0};
+    executor.start(10ms, [&count]() { ++count; });
+
+    std::this_thread::sleep_for(105ms);
+    executor.pause();
+    std::this_thread::sleep_for(5ms);
+    const int paused_at = count.load();
+    BOOST_CHECK_GE(paused_at, 8);
+    std::this_thread::sleep_for(60ms);
+    BOOST_CHECK_EQUAL(count.load(), paused_at);
+
+    executor.resume();
+    std::this_thread::sleep_for(55ms);
+    executor.stop();
+    BOOST_CHECK_GE(count.load(), paused_at + 4);
+}
+
+/**
+ * @brief Returns the number of open file descriptors, or -1 where it cannot be read.
+ */
+static int open_descriptors() {
+#if defined(__linux__)
+    DIR* directory = opendir("/proc/self/fd");
+    if (directory == nullptr) {
+        return -1;
+    }
+    int count = 0;
+    while (readdir(directory) != nullptr) {
+        ++count;
+    }
+    closedir(directory);
+    return count;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Tests that the runtime is created on `\`start()\``, released on `\`stop()\``,
+ * and that a worker with a reduced stack runs and can be restarted.
+ */
+BOOST_AUTO_TEST_CASE(Test_12_LazyRuntimeAndStackSize) {
+    const int before = open_descriptors();
+    std::vector<PeriodicExecutor<>> idle(16);
+    BOOST_CHECK_EQUAL(open_descriptors(), before);
+
+    PeriodicExecutor<> executor;
+    executor.set_stack_size(64 * 1024);
+    std::atomic<int> count{0};
+    for (int run = 0; run < 2; ++run) {
+        BOOST_CHECK(executor.start(5ms, [&count]() { ++count; }));
+        std::this_thread::sleep_for(52ms);
+        executor.stop();
+        BOOST_CHECK_EQUAL(open_descriptors(), before);
+    }
+    BOOST_CHECK_GE(count.load(), 12);
+}
+
+/**
+ * @brief Tests that executors are cache-line aligned, so neighbours in an array share no line.
+ */
+BOOST_AUTO_TEST_CASE(Test_13_CacheLineLayout) {
+    static_assert(alignof(PeriodicExecutor<>) >= 64, "executor must start a cache line");
+    static_assert(sizeof(PeriodicExecutor<>) % 64 == 0, "executor must end on a cache line");
+    static_assert(alignof(PeriodicExecutor<boost::asio::io_context::executor_type, MinimalExecutorPolicies>) >= 64,
+                  "policies must not change the layout");
+
+    std::vector<PeriodicExecutor<>> executors(4);
+    std::atomic<int> count{0};
+    for (auto& executor : executors) {
+        BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(&executor) % 64, 0u);
+        executor.start(5ms, [&count]() { ++count; });
+    }
+    std::this_thread::sleep_for(52ms);
+    for (auto& executor : executors) {
+        executor.stop();
+    }
+    BOOST_CHECK_GE(count.load(), 4 * 8);
+}
+
+/**
+ * @brief Tests that a plain `\`start()\`` after a bounded run is unbounded again.
+ *
+ * @details Each bounded mode runs to completion; the following unbounded run on the
+ * same executor must keep ticking past the old bound and must not report `finished()`.
+ * The second restart happens without `stop()`, which a finished run does not need.
+ */
+BOOST_AUTO_TEST_CASE(Test_14_RestartAfterBoundedRuns) {
+    PeriodicExecutor<> executor;
+    std::atomic<int> count{0};
+
+    BOOST_CHECK(executor.start(5ms, 3, [&count]() { ++count; }));
+    std::this_thread::sleep_for(40ms);
+    BOOST_CHECK(executor.finished());
+    executor.stop();
+    count = 0;
+    BOOST_CHECK(executor.start(5ms, [&count]() { ++count; }));
+    std::this_thread::sleep_for(52ms);
+    BOOST_CHECK(!executor.finished());
+    executor.stop();
+    BOOST_CHECK_GE(count.load(), 8);
+
+    BOOST_CHECK(executor.start_until(5ms, std::chrono::steady_clock::now() + 12ms, [&count]() { ++count; }));
+    std::this_thread::sleep_for(40ms);
+    BOOST_CHECK(executor.finished());
+    // A finished run releases the executor; no stop() is needed before the next start().
+    count = 0;
+    BOOST_CHECK(executor.start(5ms, [&count]() { ++count; }));
+    std::this_thread::sleep_for(52ms);
+    BOOST_CHECK(!executor.finished());
+    executor.stop();
+    BOOST_CHECK_GE(count.load(), 8);
+}
+
+/**
+ * @brief Tests that an adapted interval keeps a consistent grid for phase-preserving resume.
+ *
+ * @details The idle poller runs at 10, 40 (now 30ms) and 130ms (now 90ms), then every
+ * 90ms on the grid anchored at 40ms: 220, 310ms. A grid still anchored at the start
+ * would put the first deadline after the pause at 360ms instead of 310ms.
+ */
+BOOST_AUTO_TEST_CASE(Test_15_AdaptiveIntervalPreservesPhase) {
+    PeriodicExecutor<> executor;
+    std::vector<std::chrono::steady_clock::duration> times;
+    std::mutex times_mutex;
+
+    const auto start_time = std::chrono::steady_clock::now();
+    executor.start(AdaptiveInterval{10ms, 90ms, 3.0, 10ms}, [&]() {
+        std::lock_guard<std::mutex> lock(times_mutex);
+        times.push_back(std::chrono::steady_clock::now() - start_time);
+        return PollResult::Idle;
+    });
+    std::this_thread::sleep_for(240ms);
+    executor.pause();
+    std::this_thread::sleep_for(50ms);
+    executor.resume(ResumeMode::PreservePhase);
+    std::this_thread::sleep_for(60ms);
+    executor.stop();
+
+    std::lock_guard<std::mutex> lock(times_mutex);
+    BOOST_REQUIRE_EQUAL(times.size(), 5u);
+    BOOST_CHECK(times[4] >= 310ms);
+    BOOST_CHECK(times[4] < 310ms + TIME_TOLERANCE / 2);
+}
+
+/**
+ * @brief Tests that adaptive polling compiles and runs with the inline-callback policies.
+ *
+ * @details `\`MinimalExecutorPolicies\`` and `\`SingleThreadedExecutorPolicies\`` store the
+ * callback in a 64-byte `\`InplaceFunction\``, which the adaptive wrapper must fit.
+ */
+BOOST_AUTO_TEST_CASE(Test_16_AdaptiveIntervalWithMinimalPolicies) {
+    PeriodicExecutor<boost::asio::io_context::executor_type, MinimalExecutorPolicies> minimal;
+    PeriodicExecutor<boost::asio::io_context::executor_type, SingleThreadedExecutorPolicies> single_threaded;
+    std::atomic<int> minimal_polls{0};
+    std::atomic<int> single_threaded_polls{0};
+
+    const AdaptiveInterval config{5ms, 20ms, 2.0, 5ms};
+    BOOST_CHECK(minimal.start(config, [&minimal_polls]() { ++minimal_polls; return PollResult::WorkFound; }));
+    BOOST_CHECK(single_threaded.start(config, [&single_threaded_polls]() { ++single_threaded_polls; return PollResult::WorkFound; }));
+    std::this_thread::sleep_for(52ms);
+    minimal.stop();
+    single_threaded.stop();
+
+    BOOST_CHECK_GE(minimal_polls.load(), 8);
+    BOOST_CHECK_GE(single_threaded_polls.load(), 8);
+}
+
+/**
+ * @brief Tests bounded runs that end while `\`stop()\`` or `\`start()\`` is called.
+ *
+ * @details The single execution of a 1ms bounded run lands around the time the control
+ * thread stops or restarts the executor, so the worker's `\`finish()\`` races with the
+ * control call on each iteration. Every call must keep the executor consistent; run
+ * under ThreadSanitizer (`\`-DPERIODIC_EXECUTOR_SANITIZER=thread\``) this must be clean.
+ */
+BOOST_AUTO_TEST_CASE(Test_17_BoundedRunEndsDuringControl) {
+    PeriodicExecutor<> executor;
+    std::atomic<int> count{0};
+    int started = 0;
+    for (int i = 0; i < 100; ++i) {
+        if (executor.start(1ms, 1, [&count]() { ++count; })) {
+            ++started;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(800 + (i % 5) * 100));
+        if (i % 2 == 0) {
+            executor.stop();
+        }
+    }
+    executor.stop();
+
+    BOOST_CHECK_GE(started, 50);
+    BOOST_CHECK_LE(count.load(), started);
+    BOOST_CHECK(executor.start(1ms, 1, [&count]() { ++count; }));
+    std::this_thread::sleep_for(20ms);
+    BOOST_CHECK(executor.finished());
+}
+
+/**
+ * @brief Tests that no handler touches an executor on an external pool after `\`stop()\``.
+ *
+ * @details The callback runs on an external `\`io_context\`` served by two threads and takes a while, so
+ * `\`stop()\`` often lands while it runs or while the next wait is queued on the strand.
+ * The executor is destroyed right after `\`stop()\``; no callback may start after that
+ * point, which would otherwise run on a destroyed object.
+ */
+BOOST_AUTO_TEST_CASE(Test_18_ExternalExecutorStopsHandlers) {
+    boost::asio::io_context context;
+    auto guard = boost::asio::make_work_guard(context);
+    std::thread pool[] = {std::thread([&context]() { context.run(); }), std::thread([&context]() { context.run(); })};
+    std::atomic<bool> stopped{false};
+    std::atomic<int> count{0};
+    std::atomic<int> late{0};
+    for (int i = 0; i < 50; ++i) {
+        stopped = false;
+        auto executor = std::make_unique<PeriodicExecutor<>>(context.get_executor());
+        executor->start(1ms, [&]() {
+            if (stopped) {
+                late++;
+            }
+            count++;
+            std::this_thread::sleep_for(300us);
+        });
+        std::this_thread::sleep_for(std::chrono::microseconds(2000 + 100 * (i % 10)));
+        executor->stop();
+        stopped = true;
+        executor.reset();
+    }
+    std::this_thread::sleep_for(10ms);
+    guard.reset();
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    BOOST_CHECK_GE(count.load(), 50);
+    BOOST_CHECK_EQUAL(late.load(), 0);
+}
+
+/**
+ * @brief Tests that invalid adaptive configurations are rejected without starting.
+ */
+BOOST_AUTO_TEST_CASE(Test_19_AdaptiveIntervalValidation) {
+    PeriodicExecutor<> executor;
+    const auto poll = []() { return PollResult::Idle; };
+    BOOST_CHECK_THROW(executor.start(AdaptiveInterval{0ms, 10ms}, poll), std::invalid_argument);
+    BOOST_CHECK_THROW(executor.start(AdaptiveInterval{20ms, 10ms}, poll), std::invalid_argument);
+    BOOST_CHECK_THROW(executor.start(AdaptiveInterval{5ms, 10ms, 0.5}, poll), std::invalid_argument);
+    BOOST_CHECK_THROW(executor.start(AdaptiveInterval{5ms, 10ms, 2.0, -1ms}, poll), std::invalid_argument);
+
+    // A rejected configuration leaves the executor stopped, so a valid one starts it.
+    BOOST_CHECK(executor.start(AdaptiveInterval{5ms, 5ms}, poll));
+    BOOST_CHECK(!executor.start(AdaptiveInterval{5ms, 10ms}, poll));
+    executor.stop();
+}
+
 BOOST_AUTO_TEST_SUITE_END() // PeriodicExecutorTests
 
 /** @} */
\ No newline at end of file
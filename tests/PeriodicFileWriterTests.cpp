@@ -0,0 +1,147 @@
+#define BOOST_TEST_MODULE PeriodicFileWriterTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "PeriodicFileWriter.hpp" // Include the component under test
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+/**
+ * @brief Provides a fresh file path in the temporary directory and removes the file afterwards.
+ */
+struct TempFileFixture {
+    TempFileFixture()
+        : path(std::filesystem::temp_directory_path() /
+               ("periodic_file_writer_" + std::to_string(::getpid()) + ".log")) {
+        std::filesystem::remove(path);
+    }
+    ~TempFileFixture() {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+    }
+
+    /**
+     * @brief Returns the whole file as a string.
+     */
+    std::string contents() const {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    std::filesystem::path path;
+};
+
+/**
+ * @defgroup PeriodicFileWriterTestSuite PeriodicFileWriter Unit Tests
+ * @brief Test cases for verifying batched appends and the fsync policies.
+ * @{
+ */
+
+/**
+ * @brief Skips a test unless the writer submits through io_uring in this build and kernel.
+ */
+boost::test_tools::assertion_result io_uring_available(boost::unit_test::test_unit_id) {
+    PeriodicFileWriter probe("/dev/null");
+    boost::test_tools::assertion_result available(probe.uses_io_uring());
+    available.message() << "io_uring backend not built (PERIODIC_FILE_WRITER_USE_IO_URING) or unavailable";
+    return available;
+}
+
+BOOST_FIXTURE_TEST_SUITE(PeriodicFileWriterTests, TempFileFixture)
+
+/**
+ * @brief Tests that many records end up in order with far fewer write calls.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_BatchesRecordsInOrder) {
+    const int records = 5000;
+    std::string expected;
+    {
+        PeriodicFileWriter writer(path.string());
+        writer.start(10ms);
+        for (int i = 0; i < records; ++i) {
+            std::string record = std::to_string(i) + "\n";
+            expected += record;
+            writer.write(std::move(record));
+            if (i % 1000 == 999) {
+                std::this_thread::sleep_for(15ms);
+            }
+        }
+        writer.write(std::string());
+        writer.stop();
+
+        BOOST_CHECK_EQUAL(writer.records_written(), static_cast<std::uint64_t>(records + 1));
+        BOOST_CHECK_LT(writer.write_calls(), static_cast<std::uint64_t>(records / 100));
+        BOOST_CHECK_EQUAL(writer.fsync_calls(), 0u);
+        BOOST_CHECK(!writer.last_error());
+    }
+    BOOST_CHECK(contents() == expected);
+}
+
+/**
+ * @brief Tests that `EveryTick` syncs once per tick with data and `EveryNTicks` less often.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_FsyncPolicies) {
+    PeriodicFileWriter every_tick(path.string(), FsyncPolicy::EveryTick);
+    PeriodicFileWriter every_fourth(path.string(), FsyncPolicy::EveryNTicks, 4);
+    every_tick.start(10ms);
+    every_fourth.start(10ms);
+    for (int i = 0; i < 8; ++i) {
+        every_tick.write("tick\n");
+        every_fourth.write("fourth\n");
+        std::this_thread::sleep_for(15ms);
+    }
+    every_tick.stop();
+    every_fourth.stop();
+
+    BOOST_CHECK_GE(every_tick.fsync_calls(), 6u);
+    BOOST_CHECK_LE(every_tick.fsync_calls(), every_tick.write_calls());
+    BOOST_CHECK_GE(every_fourth.fsync_calls(), 1u);
+    BOOST_CHECK_LE(every_fourth.fsync_calls(), 5u);
+    BOOST_CHECK_EQUAL(every_tick.records_written() + every_fourth.records_written(), 16u);
+}
+
+/**
+ * @brief Tests that an unopenable path throws `std::system_error`.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_OpenFailureThrows) {
+    BOOST_CHECK_THROW(PeriodicFileWriter((path / "missing" / "file.log").string()), std::system_error);
+}
+
+/**
+ * @brief Tests linked write+fsync submissions through io_uring.
+ *
+ * @details Every tick carries records and a linked fsync, so each submission reaps two
+ * completions. Records must arrive in order, every tick must be synced by the linked
+ * request, and the ring must still be in use afterwards.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_IoUringLinkedSync, *boost::unit_test::precondition(io_uring_available)) {
+    std::string expected;
+    {
+        PeriodicFileWriter writer(path.string(), FsyncPolicy::EveryTick);
+        writer.start(5ms);
+        for (int i = 0; i < 20; ++i) {
+            std::string record = "record " + std::to_string(i) + "\n";
+            expected += record;
+            writer.write(std::move(record));
+            std::this_thread::sleep_for(7ms);
+        }
+        writer.stop();
+
+        BOOST_CHECK(writer.uses_io_uring());
+        BOOST_CHECK(!writer.last_error());
+        BOOST_CHECK_EQUAL(writer.records_written(), 20u);
+        BOOST_CHECK_GE(writer.fsync_calls(), 10u);
+    }
+    BOOST_CHECK(contents() == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PeriodicFileWriterTests
+
+/** @} */
@@ -0,0 +1,171 @@
+#define BOOST_TEST_MODULE PeriodicPipelineTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "PeriodicPipeline.hpp" // Include the component under test
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup PipelineTestSuite PeriodicPipeline Unit Tests
+ * @brief Test cases for per-tick dependency ordering and buffer handoff.
+ * @{
+ */
+
+BOOST_AUTO_TEST_SUITE(PeriodicPipelineTests)
+
+/**
+ * @brief Tests a linear sample → filter → publish chain.
+ *
+ * @details Verifies that each stage sees the value its predecessor produced in the
+ * same tick, and that the handoff reads the producer's buffer in place.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_LinearChainZeroCopy) {
+    PeriodicPipeline pipeline;
+    std::atomic<int> ticks{0};
+    std::atomic<int> mismatches{0};
+    std::atomic<const void*> sample_buffer{nullptr};
+    std::atomic<int> moved_buffers{0};
+
+    auto sample = pipeline.add_stage<std::array<int, 64>>([&](std::array<int, 64>& out) {
+        out.fill(ticks.load());
+        if (sample_buffer == nullptr) {
+            sample_buffer = &out;
+        } else if (sample_buffer != &out) {
+            moved_buffers++;
+        }
+    });
+    auto filter = pipeline.add_stage<long>([&](long& out) {
+        const auto& in = pipeline.input(sample);
+        if (&in != sample_buffer.load()) {
+            moved_buffers++;
+        }
+        out = 0;
+        for (int v : in) {
+            out += v;
+        }
+    }, {sample});
+    pipeline.add_stage<void>([&]() {
+        if (pipeline.input(filter) != 64L * ticks.load()) {
+            mismatches++;
+        }
+        ticks++;
+    }, {filter});
+
+    pipeline.start(20ms);
+    std::this_thread::sleep_for(210ms);
+    pipeline.stop();
+
+    BOOST_CHECK_GE(ticks.load(), 8);
+    BOOST_CHECK_EQUAL(mismatches.load(), 0);
+    BOOST_CHECK_EQUAL(moved_buffers.load(), 0);
+}
+
+/**
+ * @brief Tests a diamond graph on the thread pool.
+ *
+ * @details `source` feeds two independent branches that are joined by `sink`; the
+ * sink must see both branches' results for the current tick.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_DiamondOnThreadPool) {
+    PeriodicPipeline pipeline(2);
+    std::atomic<int> ticks{0};
+    std::atomic<int> mismatches{0};
+
+    auto source = pipeline.add_stage<int>([&](int& out) { out = ticks.load(); });
+    auto doubled = pipeline.add_stage<int>([&](int& out) { out = 2 * pipeline.input(source); }, {source});
+    auto squared = pipeline.add_stage<int>([&](int& out) {
+        const int v = pipeline.input(source);
+        out = v * v;
+    }, {source});
+    pipeline.add_stage<void>([&]() {
+        const int v = ticks.load();
+        if (pipeline.input(doubled) != 2 * v || pipeline.input(squared) != v * v) {
+            mismatches++;
+        }
+        ticks++;
+    }, {doubled, squared});
+
+    pipeline.start(20ms);
+    std::this_thread::sleep_for(210ms);
+    pipeline.stop();
+
+    BOOST_CHECK_GE(ticks.load(), 8);
+    BOOST_CHECK_EQUAL(mismatches.load(), 0);
+}
+
+/**
+ * @brief Tests that the graph cannot be changed or made cyclic.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_GraphValidation) {
+    PeriodicPipeline pipeline;
+    StageRef unknown{5};
+    BOOST_CHECK_THROW(pipeline.add_stage<void>([]() {}, {unknown}), std::logic_error);
+
+    pipeline.add_stage<void>([]() {});
+    pipeline.start(50ms);
+    BOOST_CHECK_THROW(pipeline.add_stage<void>([]() {}), std::logic_error);
+    BOOST_CHECK_EQUAL(pipeline.start(50ms), false);
+    pipeline.stop();
+}
+
+/**
+ * @brief Tests that a stopped pipeline can be started again.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_RestartAfterStop) {
+    PeriodicPipeline pipeline(2);
+    std::atomic<int> ticks{0};
+    pipeline.add_stage<void>([&ticks]() { ticks++; });
+
+    BOOST_CHECK(pipeline.start(10ms));
+    std::this_thread::sleep_for(55ms);
+    pipeline.stop();
+    const int first_run = ticks.load();
+
+    BOOST_CHECK(pipeline.start(10ms));
+    std::this_thread::sleep_for(55ms);
+    pipeline.stop();
+
+    BOOST_CHECK_GE(first_run, 4);
+    BOOST_CHECK_GE(ticks.load(), first_run + 4);
+}
+
+/**
+ * @brief Tests that a throwing stage is reported through `\`last_error()\`` and does not stop the tick.
+ *
+ * @details The root stage throws on its second tick. Its successor must still run on
+ * that tick, and both stages must keep running afterwards, inline and on the pool.
+ */
+BOOST_AUTO_TEST_CASE(Test_05_StageErrorKeepsTicking) {
+    for (std::size_t parallelism : {1u, 2u}) {
+        PeriodicPipeline pipeline(parallelism);
+        std::atomic<int> roots{0};
+        std::atomic<int> leaves{0};
+        auto root = pipeline.add_stage<int>([&roots](int& out) {
+            out = ++roots;
+            if (out == 2) {
+                throw std::runtime_error("stage failed");
+            }
+        });
+        pipeline.add_stage<void>([&leaves]() { leaves++; }, {root});
+        BOOST_CHECK(!pipeline.last_error());
+
+        pipeline.start(10ms);
+        std::this_thread::sleep_for(75ms);
+        pipeline.stop();
+
+        BOOST_CHECK_GE(roots.load(), 5);
+        BOOST_CHECK_EQUAL(leaves.load(), roots.load());
+        BOOST_REQUIRE(pipeline.last_error());
+        BOOST_CHECK_THROW(std::rethrow_exception(pipeline.last_error()), std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PeriodicPipelineTests
+
+/** @} */
@@ -0,0 +1,109 @@
+#define BOOST_TEST_MODULE PeriodicPublisherTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "PeriodicPublisher.hpp" // Include the component under test
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup PublisherTestSuite PeriodicPublisher Unit Tests
+ * @brief Test cases for verifying lock-free snapshot publication.
+ * @{
+ */
+
+namespace {
+
+/**
+ * @brief A snapshot whose fields must always be consistent with each other.
+ */
+struct Health {
+    std::uint64_t generation;
+    std::uint64_t checksum;
+    /**< @brief Always `~generation`; a torn read breaks the relation. */
+    double values[14];
+    /**< @brief Padding to make the snapshot span two cache lines. */
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PeriodicPublisherTests)
+
+/**
+ * @brief Tests that the initial value is readable before the first tick.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_InitialValue) {
+    PeriodicPublisher<int> publisher([](int& value) { ++value; }, 41);
+    BOOST_CHECK_EQUAL(publisher.latest(), 41);
+    BOOST_CHECK_EQUAL(publisher.version(), 0u);
+
+    int out = 0;
+    std::uint64_t seen = 0;
+    BOOST_CHECK(!publisher.read_if_newer(out, seen));
+    publisher.start(10ms);
+    std::this_thread::sleep_for(35ms);
+    publisher.stop();
+    BOOST_CHECK(publisher.read_if_newer(out, seen));
+    BOOST_CHECK_EQUAL(out, 41 + static_cast<int>(seen));
+    BOOST_CHECK_EQUAL(seen, publisher.version());
+    BOOST_CHECK(!publisher.read_if_newer(out, seen));
+}
+
+/**
+ * @brief Tests that concurrent readers never observe a torn snapshot.
+ *
+ * @details The publisher rewrites a two-cache-line snapshot every millisecond while
+ * four readers copy it in a tight loop; every copy must satisfy the checksum and
+ * generations must never go backwards for a reader.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_ReadersSeeConsistentSnapshots) {
+    PeriodicPublisher<Health> publisher([](Health& health) {
+        ++health.generation;
+        health.checksum = ~health.generation;
+        for (double& value : health.values) {
+            value = static_cast<double>(health.generation);
+        }
+    }, Health{0, ~std::uint64_t{0}, {}});
+    publisher.start(1ms);
+
+    std::atomic<bool> done{false};
+    std::atomic<int> torn{0};
+    std::atomic<int> backwards{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&]() {
+            std::uint64_t last = 0;
+            while (!done) {
+                const Health health = publisher.latest();
+                if (health.checksum != ~health.generation ||
+                    (health.generation != 0 && health.values[13] != static_cast<double>(health.generation))) {
+                    torn++;
+                }
+                if (health.generation < last) {
+                    backwards++;
+                }
+                last = health.generation;
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(200ms);
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    publisher.stop();
+
+    BOOST_CHECK_EQUAL(torn.load(), 0);
+    BOOST_CHECK_EQUAL(backwards.load(), 0);
+    BOOST_CHECK_GE(publisher.version(), 100u);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PeriodicPublisherTests
+
+/** @} */
@@ -0,0 +1,158 @@
+#define BOOST_TEST_MODULE PeriodicSamplerTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "PeriodicSampler.hpp" // Include the component under test
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup SamplerTestSuite PeriodicSampler Unit Tests
+ * @brief Test cases for verifying the SampleRing policies and the PeriodicSampler.
+ * @{
+ */
+
+namespace {
+
+/**
+ * @brief A record tagged with its producer and per-producer sequence number.
+ */
+struct Tagged {
+    std::uint32_t producer;
+    std::uint32_t sequence;
+};
+
+/**
+ * @brief Runs producers against one consumer and checks per-producer ordering.
+ * @return The number of records received.
+ */
+template <ProducerMode Mode>
+std::uint64_t run_concurrent(SampleRing<Tagged, Mode>& ring, unsigned producers, std::uint32_t per_producer) {
+    std::atomic<unsigned> finished{0};
+    std::vector<std::thread> threads;
+    for (unsigned p = 0; p < producers; ++p) {
+        threads.emplace_back([&ring, &finished, p, per_producer]() {
+            for (std::uint32_t i = 0; i < per_producer; ++i) {
+                ring.push(Tagged{p, i});
+            }
+            finished++;
+        });
+    }
+
+    std::vector<long long> last(producers, -1);
+    std::vector<Tagged> batch(256);
+    std::uint64_t received = 0;
+    bool ordered = true;
+    for (;;) {
+        const bool done = finished.load() == producers;
+        const std::size_t count = ring.pop_batch(batch.data(), batch.size());
+        for (std::size_t i = 0; i < count; ++i) {
+            ordered = ordered && static_cast<long long>(batch[i].sequence) > last[batch[i].producer];
+            last[batch[i].producer] = batch[i].sequence;
+        }
+        received += count;
+        if (done && count == 0) {
+            break;
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    BOOST_CHECK(ordered);
+    return received;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(PeriodicSamplerTests)
+
+/**
+ * @brief Tests that a full ring under the drop policy rejects new records.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_DropPolicy) {
+    SampleRing<int> ring(3, OverflowPolicy::Drop);
+    BOOST_REQUIRE_EQUAL(ring.capacity(), 4u);
+    for (int i = 1; i <= 6; ++i) {
+        BOOST_CHECK_EQUAL(ring.push(i), i <= 4);
+    }
+    BOOST_CHECK_EQUAL(ring.dropped(), 2u);
+
+    int out[8];
+    BOOST_REQUIRE_EQUAL(ring.pop_batch(out, 8), 4u);
+    for (int i = 0; i < 4; ++i) {
+        BOOST_CHECK_EQUAL(out[i], i + 1);
+    }
+    BOOST_CHECK(ring.push(7));
+    BOOST_REQUIRE_EQUAL(ring.pop_batch(out, 8), 1u);
+    BOOST_CHECK_EQUAL(out[0], 7);
+}
+
+/**
+ * @brief Tests that the overwrite policy keeps the newest records.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_OverwritePolicy) {
+    SampleRing<int> ring(4, OverflowPolicy::Overwrite);
+    for (int i = 1; i <= 10; ++i) {
+        BOOST_CHECK(ring.push(i));
+    }
+
+    int out[8];
+    BOOST_REQUIRE_EQUAL(ring.pop_batch(out, 2), 2u);
+    BOOST_CHECK_EQUAL(out[0], 7);
+    BOOST_CHECK_EQUAL(out[1], 8);
+    BOOST_CHECK_EQUAL(ring.overwritten(), 6u);
+    BOOST_REQUIRE_EQUAL(ring.pop_batch(out, 8), 2u);
+    BOOST_CHECK_EQUAL(out[0], 9);
+    BOOST_CHECK_EQUAL(out[1], 10);
+}
+
+/**
+ * @brief Tests concurrent producers against one consumer under both policies.
+ *
+ * @details Each producer's records must arrive in order. With dropping, every record
+ * is either received or counted as dropped.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_ConcurrentProducers) {
+    const std::uint32_t per_producer = 100000;
+
+    SampleRing<Tagged, ProducerMode::Multi> dropping(1024, OverflowPolicy::Drop);
+    const std::uint64_t received = run_concurrent(dropping, 4, per_producer);
+    BOOST_CHECK_EQUAL(received + dropping.dropped(), 4u * per_producer);
+
+    SampleRing<Tagged, ProducerMode::Multi> overwriting(1024, OverflowPolicy::Overwrite);
+    BOOST_CHECK_LE(run_concurrent(overwriting, 4, per_producer), 4u * per_producer);
+
+    SampleRing<Tagged> single(1024, OverflowPolicy::Drop);
+    const std::uint64_t single_received = run_concurrent(single, 1, per_producer);
+    BOOST_CHECK_EQUAL(single_received + single.dropped(), per_producer);
+}
+
+/**
+ * @brief Tests that the sampler writes one record per tick.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_SamplerFillsRing) {
+    SampleRing<int> ring(64, OverflowPolicy::Drop);
+    int counter = 0;
+    PeriodicSampler<int> sampler(ring, [&counter](int& record) { record = ++counter; });
+
+    sampler.start(10ms);
+    std::this_thread::sleep_for(115ms);
+    sampler.stop();
+
+    int out[64];
+    const std::size_t count = ring.pop_batch(out, 64);
+    BOOST_CHECK_GE(count, 10u);
+    BOOST_CHECK_LE(count, 12u);
+    for (std::size_t i = 0; i < count; ++i) {
+        BOOST_CHECK_EQUAL(out[i], static_cast<int>(i) + 1);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PeriodicSamplerTests
+
+/** @} */
@@ -0,0 +1,341 @@
+#define BOOST_TEST_MODULE PeriodicSchedulerTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "PeriodicScheduler.hpp" // Include the component under test
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup SchedulerTestSuite PeriodicScheduler Unit Tests
+ * @brief Test cases for verifying dispatch order and lifecycle of PeriodicScheduler.
+ * @{
+ */
+
+/**
+ * @brief Records the order in which task callbacks run.
+ */
+struct TraceFixture {
+    std::vector<std::string> trace;
+    std::mutex trace_mutex;
+
+    std::function<void()> record(const std::string& name) {
+        return [this, name]() {
+            std::lock_guard<std::mutex> lock(trace_mutex);
+            trace.push_back(name);
+        };
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(PeriodicSchedulerTests, TraceFixture)
+
+/**
+ * @brief Tests that explicit priorities order tasks due in the same wakeup.
+ *
+ * @details Both tasks share a period and an anchor, so every wakeup dispatches
+ * both; the higher-priority task must always run first.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_ExplicitPriorityOrder) {
+    PeriodicScheduler scheduler;
+    scheduler.add_task(50ms, record("housekeeping"), 1);
+    scheduler.add_task(50ms, record("control"), 10);
+    scheduler.start();
+
+    std::this_thread::sleep_for(280ms);
+    scheduler.stop();
+
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    BOOST_REQUIRE_GE(trace.size(), 8u);
+    for (std::size_t i = 0; i + 1 < trace.size(); i += 2) {
+        BOOST_CHECK_EQUAL(trace[i], "control");
+        BOOST_CHECK_EQUAL(trace[i + 1], "housekeeping");
+    }
+}
+
+/**
+ * @brief Tests rate-monotonic ordering by period.
+ *
+ * @details At every multiple of 100ms both tasks are due; the 50ms task has the
+ * shorter period and must run first despite its lower explicit priority.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_RateMonotonicOrder) {
+    PeriodicScheduler scheduler(PriorityPolicy::RateMonotonic);
+    scheduler.add_task(100ms, record("slow"), 10);
+    scheduler.add_task(50ms, record("fast"), 0);
+    scheduler.start();
+
+    std::this_thread::sleep_for(330ms);
+    scheduler.stop();
+
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    BOOST_REQUIRE_GE(trace.size(), 8u);
+    for (std::size_t i = 0; i < trace.size(); ++i) {
+        if (trace[i] == "slow") {
+            BOOST_REQUIRE_GT(i, 0u);
+            BOOST_CHECK_EQUAL(trace[i - 1], "fast");
+        }
+    }
+}
+
+/**
+ * @brief Tests preempt-by-deferral.
+ *
+ * @details The low-priority task is due at 90ms, the high-priority one at 100ms.
+ * With a 20ms deferral window the low-priority task must be held back until the
+ * high-priority task has run.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_DeferralBehindImminentTask) {
+    PeriodicScheduler scheduler;
+    scheduler.set_deferral_window(20ms);
+    scheduler.add_task(90ms, record("low"), 0);
+    scheduler.add_task(100ms, record("high"), 5);
+    scheduler.start();
+
+    std::this_thread::sleep_for(150ms);
+    scheduler.stop();
+
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    BOOST_REQUIRE_EQUAL(trace.size(), 2u);
+    BOOST_CHECK_EQUAL(trace[0], "high");
+    BOOST_CHECK_EQUAL(trace[1], "low");
+}
+
+/**
+ * @brief Tests that removed tasks are no longer dispatched.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_RemoveTask) {
+    PeriodicScheduler scheduler;
+    const auto id = scheduler.add_task(20ms, record("removed"));
+    scheduler.start();
+
+    std::this_thread::sleep_for(70ms);
+    scheduler.remove_task(id);
+    std::this_thread::sleep_for(10ms);
+    std::size_t count_after_remove;
+    {
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        count_after_remove = trace.size();
+    }
+    std::this_thread::sleep_for(100ms);
+    scheduler.stop();
+
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    BOOST_CHECK_GE(count_after_remove, 2u);
+    BOOST_CHECK_EQUAL(trace.size(), count_after_remove);
+}
+
+/**
+ * @brief Tests that EDF runs ready one-shot jobs strictly by deadline.
+ *
+ * @details The jobs are posted in reverse deadline order before the worker starts,
+ * so all of them are ready in the first dispatch step.
+ */
+BOOST_AUTO_TEST_CASE(Test_05_EdfOrdersByDeadline) {
+    PeriodicScheduler scheduler(PriorityPolicy::EarliestDeadlineFirst);
+    const auto now = PeriodicScheduler::clock_type::now();
+    scheduler.post_at(now + 300ms, record("third"));
+    scheduler.post_at(now + 100ms, record("first"));
+    scheduler.post_at(now + 200ms, record("second"));
+    scheduler.start();
+
+    std::this_thread::sleep_for(50ms);
+    scheduler.stop();
+
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    BOOST_REQUIRE_EQUAL(trace.size(), 3u);
+    BOOST_CHECK_EQUAL(trace[0], "first");
+    BOOST_CHECK_EQUAL(trace[1], "second");
+    BOOST_CHECK_EQUAL(trace[2], "third");
+}
+
+/**
+ * @brief Tests that EDF mixes periodic ticks and one-shot jobs on one worker.
+ *
+ * @details The first tick posts two one-shot jobs. Both are ready at once: the urgent
+ * one runs first, and the late one fills the idle time before the tick released at
+ * 80ms.
+ */
+BOOST_AUTO_TEST_CASE(Test_06_EdfMixesPeriodicAndOneShot) {
+    PeriodicScheduler scheduler(PriorityPolicy::EarliestDeadlineFirst);
+    std::atomic<int> ticks{0};
+    scheduler.add_task(40ms, [&]() {
+        record("tick")();
+        if (++ticks == 1) {
+            const auto release = PeriodicScheduler::clock_type::now();
+            scheduler.post_at(release + 500ms, record("late"));
+            scheduler.post_at(release + 10ms, record("urgent"));
+        }
+    });
+    scheduler.start();
+
+    std::this_thread::sleep_for(100ms);
+    scheduler.stop();
+
+    std::lock_guard<std::mutex> lock(trace_mutex);
+    BOOST_REQUIRE_GE(trace.size(), 4u);
+    BOOST_CHECK_EQUAL(trace[0], "tick");
+    BOOST_CHECK_EQUAL(trace[1], "urgent");
+    BOOST_CHECK_EQUAL(trace[2], "late");
+    BOOST_CHECK_EQUAL(trace[3], "tick");
+}
+
+/**
+ * @brief Tests that under a priority policy a one-shot job fires at its deadline.
+ */
+BOOST_AUTO_TEST_CASE(Test_07_OneShotFiresAtDeadline) {
+    PeriodicScheduler scheduler;
+    std::atomic<long long> fired_ms{-1};
+    scheduler.start();
+    const auto posted = PeriodicScheduler::clock_type::now();
+    scheduler.post_at(posted + 60ms, [&]() {
+        fired_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            PeriodicScheduler::clock_type::now() - posted).count();
+    });
+
+    std::this_thread::sleep_for(150ms);
+    scheduler.stop();
+
+    BOOST_CHECK_GE(fired_ms.load(), 60);
+    BOOST_CHECK_LT(fired_ms.load(), 100);
+}
+
+/**
+ * @brief Tests that a cron task fires on whole wall-clock seconds.
+ */
+BOOST_AUTO_TEST_CASE(Test_08_CronTaskFiresOnSchedule) {
+    PeriodicScheduler scheduler;
+    std::atomic<int> fired{0};
+    std::atomic<long long> worst_offset_ms{0};
+    scheduler.add_cron_task(std::make_shared<const CronSchedule>("* * * * * *"), [&]() {
+        const auto since_epoch = CronSchedule::clock_type::now().time_since_epoch();
+        const long long offset_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+            since_epoch - std::chrono::floor<std::chrono::seconds>(since_epoch)).count();
+        worst_offset_ms = std::max(worst_offset_ms.load(), offset_ms);
+        fired++;
+    });
+    scheduler.start();
+
+    std::this_thread::sleep_for(2200ms);
+    scheduler.stop();
+
+    BOOST_CHECK_GE(fired.load(), 2);
+    BOOST_CHECK_LE(fired.load(), 3);
+    BOOST_CHECK_LT(worst_offset_ms.load(), 50);
+}
+
+/**
+ * @brief Tests that bounded tasks stop on their own after a run count or end time.
+ */
+BOOST_AUTO_TEST_CASE(Test_09_BoundedTasks) {
+    PeriodicScheduler scheduler;
+    std::atomic<int> counted{0};
+    std::atomic<int> timed{0};
+    scheduler.add_bounded_task(20ms, 3, [&]() { counted++; });
+    scheduler.start();
+    // Releases at 30, 60 and 90ms from now lie before the end time; 120ms does not.
+    scheduler.add_task_until(30ms, PeriodicScheduler::clock_type::now() + 105ms, [&]() { timed++; });
+
+    std::this_thread::sleep_for(250ms);
+    scheduler.stop();
+
+    BOOST_CHECK_EQUAL(counted.load(), 3);
+    BOOST_CHECK_EQUAL(timed.load(), 3);
+}
+
+/**
+ * @brief Tests that handles cancel one-shot and periodic tasks from another thread.
+ */
+BOOST_AUTO_TEST_CASE(Test_10_CancelHandles) {
+    PeriodicScheduler scheduler;
+    std::atomic<int> kept{0};
+    std::atomic<int> dropped{0};
+    std::atomic<int> periodic{0};
+    scheduler.start();
+
+    const auto keep = scheduler.schedule_after(40ms, [&]() { kept++; });
+    const auto drop = scheduler.schedule_after(40ms, [&]() { dropped++; });
+    const auto ticker = scheduler.add_bounded_task(20ms, 0, [&]() { periodic++; });
+    BOOST_CHECK(scheduler.cancel(drop));
+    BOOST_CHECK(!scheduler.cancel(drop));
+    BOOST_CHECK(!scheduler.active(drop));
+    BOOST_CHECK(scheduler.active(keep));
+    BOOST_CHECK_NE(keep.slot, drop.slot);
+
+    std::this_thread::sleep_for(110ms);
+    std::thread([&scheduler, ticker]() { scheduler.cancel(ticker); }).join();
+    const int ticks_at_cancel = periodic.load();
+    std::this_thread::sleep_for(100ms);
+    scheduler.stop();
+
+    BOOST_CHECK_EQUAL(kept.load(), 1);
+    BOOST_CHECK(!scheduler.active(keep)); // finished
+    BOOST_CHECK_EQUAL(dropped.load(), 0);
+    BOOST_CHECK_GE(ticks_at_cancel, 4);
+    BOOST_CHECK_EQUAL(periodic.load(), ticks_at_cancel);
+    const PeriodicScheduler::TaskHandle empty;
+    BOOST_CHECK(!scheduler.cancel(empty));
+    BOOST_CHECK(!scheduler.active(empty));
+}
+
+/**
+ * @brief Tests that released slots are reused and that their old handles stay stale.
+ */
+BOOST_AUTO_TEST_CASE(Test_11_StaleHandles) {
+    static_assert(sizeof(PeriodicScheduler::TaskHandle) == 8, "handles are a 64-bit slot/generation pair");
+    static_assert(std::is_trivially_copyable<PeriodicScheduler::TaskHandle>::value, "handles are trivially copyable");
+    PeriodicScheduler scheduler;
+    std::atomic<int> fired{0};
+    scheduler.start();
+
+    const auto first = scheduler.schedule_after(5ms, [&]() { fired++; });
+    std::this_thread::sleep_for(50ms);
+    BOOST_REQUIRE_EQUAL(fired.load(), 1);
+    BOOST_CHECK(!scheduler.active(first));
+
+    const auto second = scheduler.schedule_after(5ms, [&]() { fired++; });
+    BOOST_CHECK_EQUAL(second.slot, first.slot);
+    BOOST_CHECK_NE(second.generation, first.generation);
+    BOOST_CHECK(!scheduler.cancel(first)); // the slot now belongs to another task
+    BOOST_CHECK(scheduler.active(second));
+    std::this_thread::sleep_for(50ms);
+    scheduler.stop();
+    BOOST_CHECK_EQUAL(fired.load(), 2);
+}
+
+/**
+ * @brief Tests that deferral cannot starve a low-priority task.
+ *
+ * @details Two high-priority tasks share a 10ms period, offset by 5ms, so whenever
+ * one of them runs the other is imminent within the 8ms window. The low-priority
+ * task may be postponed once per release but must then run on the next wakeup.
+ */
+BOOST_AUTO_TEST_CASE(Test_12_DeferralDoesNotStarve) {
+    PeriodicScheduler scheduler;
+    std::atomic<int> low{0};
+    std::atomic<int> high{0};
+    scheduler.set_deferral_window(8ms);
+    scheduler.start();
+    scheduler.add_task(10ms, [&]() { high++; }, 5);
+    std::this_thread::sleep_for(5ms);
+    scheduler.add_task(10ms, [&]() { high++; }, 5);
+    scheduler.add_task(20ms, [&]() { low++; }, 0);
+
+    std::this_thread::sleep_for(200ms);
+    scheduler.stop();
+
+    BOOST_CHECK_GE(high.load(), 30);
+    BOOST_CHECK_GE(low.load(), 7);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PeriodicSchedulerTests
+
+/** @} */
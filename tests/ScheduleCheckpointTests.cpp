@@ -0,0 +1,110 @@
+#define BOOST_TEST_MODULE ScheduleCheckpointTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "PeriodicExecutor.hpp" // Include the component under test
+#include "ScheduleCheckpoint.hpp"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/**
+ * @brief Provides a fresh checkpoint path and removes the file afterwards.
+ */
+struct CheckpointFileFixture {
+    CheckpointFileFixture()
+        : path((std::filesystem::temp_directory_path() / ("schedule_checkpoint_" + std::to_string(::getpid()))).string()) {
+        std::filesystem::remove(path);
+    }
+    ~CheckpointFileFixture() {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+    }
+
+    /**
+     * @brief Runs an executor with a checkpoint on `\`path\`` and returns its execution times.
+     */
+    std::vector<std::chrono::steady_clock::time_point> run(std::chrono::milliseconds interval,
+                                                           std::chrono::milliseconds duration,
+                                                           std::uint64_t& missed) {
+        std::mutex mutex;
+        std::vector<std::chrono::steady_clock::time_point> times;
+        ScheduleCheckpoint checkpoint(path);
+        PeriodicExecutor<> executor;
+        executor.set_checkpoint(&checkpoint);
+        executor.start(interval, [&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            times.push_back(std::chrono::steady_clock::now());
+        });
+        std::this_thread::sleep_for(duration);
+        executor.stop();
+        missed = checkpoint.missed();
+        return times;
+    }
+
+    std::string path;
+};
+
+/**
+ * @defgroup ScheduleCheckpointTestSuite ScheduleCheckpoint Unit Tests
+ * @brief Test cases for verifying grid continuity across restarts.
+ * @{
+ */
+
+BOOST_FIXTURE_TEST_SUITE(ScheduleCheckpointTests, CheckpointFileFixture)
+
+/**
+ * @brief Tests that a restarted executor keeps the phase and reports the missed deadlines.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_RestartKeepsPhase) {
+    std::uint64_t missed = 0;
+    const auto first = run(10ms, 55ms, missed);
+    BOOST_CHECK_EQUAL(missed, 0u);
+    BOOST_REQUIRE_GE(first.size(), 3u);
+
+    std::this_thread::sleep_for(100ms);
+    const auto second = run(10ms, 55ms, missed);
+    BOOST_REQUIRE_GE(second.size(), 3u);
+    BOOST_CHECK_GE(missed, 7u);
+    BOOST_CHECK_LE(missed, 14u);
+
+    // Both runs lie on one 10 ms grid: the offset between any two executions is close
+    // to a multiple of the interval.
+    const auto offset = std::chrono::duration_cast<std::chrono::microseconds>(second.front() - first.front()) % 10ms;
+    const auto phase_error = std::min(offset, 10ms - offset);
+    BOOST_CHECK_LT(phase_error.count(), 3000);
+}
+
+/**
+ * @brief Tests that a different interval, or a foreign file, starts a fresh grid.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_MismatchStartsFresh) {
+    {
+        ScheduleCheckpoint checkpoint(path);
+        BOOST_CHECK(!checkpoint.begin(10ms).restored);
+        checkpoint.record(42);
+        BOOST_CHECK(checkpoint.begin(10ms).restored);
+        const ScheduleResume other = checkpoint.begin(20ms);
+        BOOST_CHECK(!other.restored);
+        BOOST_CHECK_EQUAL(other.next_index, 1u);
+        BOOST_CHECK_EQUAL(checkpoint.last_index(), 0u);
+    }
+    {
+        std::ofstream garbage(path, std::ios::binary | std::ios::trunc);
+        garbage << std::string(64, 'x');
+    }
+    ScheduleCheckpoint checkpoint(path);
+    BOOST_CHECK(!checkpoint.begin(10ms).restored);
+    BOOST_CHECK_EQUAL(checkpoint.missed(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ScheduleCheckpointTests
+
+/** @} */
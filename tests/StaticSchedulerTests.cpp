@@ -0,0 +1,137 @@
+#define BOOST_TEST_MODULE StaticSchedulerTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "StaticScheduler.hpp" // Include the component under test
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup StaticSchedulerTestSuite StaticScheduler Unit Tests
+ * @brief Test cases for verifying the fixed-capacity, allocation-free scheduler.
+ * @{
+ */
+
+BOOST_AUTO_TEST_SUITE(StaticSchedulerTests)
+
+/**
+ * @brief Tests that tasks fire at their rate and stop after `\`cancel()\``.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_FireAndCancel) {
+    StaticScheduler<4> scheduler;
+    std::atomic<int> fast{0};
+    std::atomic<int> slow{0};
+    const auto fast_handle = scheduler.add_task(10ms, [&fast]() { ++fast; });
+    scheduler.add_task(50ms, [&slow]() { ++slow; });
+    BOOST_CHECK(scheduler.start());
+
+    std::this_thread::sleep_for(225ms);
+    BOOST_CHECK(scheduler.cancel(fast_handle));
+    const int fast_at_cancel = fast.load();
+    std::this_thread::sleep_for(60ms);
+    scheduler.stop();
+
+    BOOST_CHECK_GE(fast_at_cancel, 18);
+    BOOST_CHECK_LE(fast_at_cancel, 23);
+    BOOST_CHECK_LE(fast.load(), fast_at_cancel + 1);
+    BOOST_CHECK_GE(slow.load(), 5);
+    BOOST_CHECK_EQUAL(scheduler.size(), 1u);
+}
+
+/**
+ * @brief Tests the capacity limit and that stale handles are rejected.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_CapacityAndStaleHandles) {
+    StaticScheduler<2> scheduler;
+    const auto first = scheduler.add_task(1000ms, []() {});
+    const auto second = scheduler.add_task(1000ms, []() {});
+    BOOST_CHECK(first.valid());
+    BOOST_CHECK(second.valid());
+    BOOST_CHECK(!scheduler.add_task(1000ms, []() {}).valid());
+
+    BOOST_CHECK(scheduler.cancel(first));
+    BOOST_CHECK(!scheduler.cancel(first));
+    const auto reused = scheduler.add_task(1000ms, []() {});
+    BOOST_REQUIRE(reused.valid());
+    BOOST_CHECK_EQUAL(reused.slot, first.slot);
+    BOOST_CHECK(!scheduler.cancel(first)); // the slot now belongs to another task
+    BOOST_CHECK(scheduler.cancel(reused));
+    BOOST_CHECK_EQUAL(scheduler.size(), 1u);
+}
+
+/**
+ * @brief Tests that adding, firing and cancelling tasks never calls `\`operator new\``.
+ *
+ * @details After `\`start()\`` has created the worker thread, `\`operator new\`` is made
+ * to fail. Tasks are then added, fire several times (one cancels itself from its own
+ * callback) and are cancelled from the test thread.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_NoHeapAfterStart) {
+    using Scheduler = StaticScheduler<8, 48>;
+    Scheduler scheduler;
+    std::atomic<int> ticks{0};
+    std::atomic<int> self_ticks{0};
+    std::atomic<Scheduler::TaskHandle> self{Scheduler::TaskHandle{}};
+    scheduler.start();
+
+    heap_mode.store(HeapMode::Banned);
+    Scheduler::TaskHandle handles[4];
+    for (auto& handle : handles) {
+        handle = scheduler.add_task(5ms, [&ticks]() { ++ticks; });
+    }
+    self = scheduler.add_task(5ms, [&scheduler, &self, &self_ticks]() {
+        if (++self_ticks == 3) {
+            scheduler.cancel(self.load());
+        }
+    });
+    std::this_thread::sleep_for(60ms);
+    for (const auto& handle : handles) {
+        scheduler.cancel(handle);
+    }
+    std::this_thread::sleep_for(20ms);
+    heap_mode.store(HeapMode::Allowed);
+    scheduler.stop();
+
+    BOOST_CHECK_EQUAL(heap_allocations.load(), 0);
+    BOOST_CHECK_GE(ticks.load(), 4 * 8);
+    BOOST_CHECK_EQUAL(self_ticks.load(), 3);
+    BOOST_CHECK_EQUAL(scheduler.size(), 0u);
+}
+
+/**
+ * @brief Tests that tasks keep firing after `\`stop()\`` and a second `\`start()\``.
+ *
+ * @details The scheduler is stopped for longer than the task period, so the releases
+ * queued at stop time must be moved past the stopped period rather than replayed.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_RestartAfterStop) {
+    StaticScheduler<4> scheduler;
+    std::atomic<int> count{0};
+    scheduler.add_task(10ms, [&count]() { ++count; });
+
+    BOOST_CHECK(scheduler.start());
+    std::this_thread::sleep_for(55ms);
+    scheduler.stop();
+    const int first_run = count.load();
+    BOOST_CHECK_GE(first_run, 3);
+
+    std::this_thread::sleep_for(50ms);
+    BOOST_CHECK_EQUAL(count.load(), first_run);
+
+    BOOST_CHECK(scheduler.start());
+    std::this_thread::sleep_for(5ms);
+    BOOST_CHECK_LE(count.load(), first_run + 1); // no burst for the stopped period
+    std::this_thread::sleep_for(50ms);
+    scheduler.stop();
+    BOOST_CHECK_GE(count.load() - first_run, 3);
+    BOOST_CHECK_LE(count.load() - first_run, 6);
+    BOOST_CHECK_EQUAL(scheduler.size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // StaticSchedulerTests
+
+/** @} */
@@ -0,0 +1,144 @@
+#define BOOST_TEST_MODULE TaskPoolTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "TaskPool.hpp" // Include the component under test
+#include "PeriodicScheduler.hpp"
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup TaskPoolTestSuite TaskPool Unit Tests
+ * @brief Test cases for verifying the slab allocator and its use by the scheduler.
+ * @{
+ */
+
+BOOST_AUTO_TEST_SUITE(TaskPoolTests)
+
+/**
+ * @brief Tests that freed blocks are reused and that size classes are kept apart.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_ReusesBlocks) {
+    void* first = TaskPool::allocate(40);
+    TaskPool::deallocate(first, 40);
+    void* again = TaskPool::allocate(48); // same 48-byte class
+    BOOST_CHECK_EQUAL(again, first);
+    void* other = TaskPool::allocate(64);
+    BOOST_CHECK_NE(other, first);
+    BOOST_CHECK_EQUAL(reinterpret_cast<std::uintptr_t>(other) % 16, 0u);
+    TaskPool::deallocate(again, 48);
+    TaskPool::deallocate(other, 64);
+
+    heap_mode.store(HeapMode::Counted);
+    void* large = TaskPool::allocate(TaskPool::max_block + 1);
+    heap_mode.store(HeapMode::Allowed);
+    BOOST_CHECK_EQUAL(heap_allocations.exchange(0), 1);
+    TaskPool::deallocate(large, TaskPool::max_block + 1);
+}
+
+/**
+ * @brief Tests blocks allocated on one thread and freed on others.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_CrossThreadFree) {
+    std::vector<void*> blocks;
+    for (int i = 0; i < 1000; ++i) {
+        blocks.push_back(TaskPool::allocate(32));
+        *static_cast<int*>(blocks.back()) = i;
+    }
+    std::vector<std::thread> threads;
+    for (int part = 0; part < 4; ++part) {
+        threads.emplace_back([&blocks, part]() {
+            for (std::size_t i = part; i < blocks.size(); i += 4) {
+                TaskPool::deallocate(blocks[i], 32);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // The exited threads returned their caches; reallocating draws on them.
+    heap_mode.store(HeapMode::Counted);
+    for (auto& block : blocks) {
+        block = TaskPool::allocate(32);
+    }
+    heap_mode.store(HeapMode::Allowed);
+    BOOST_CHECK_EQUAL(heap_allocations.exchange(0), 0);
+    for (void* block : blocks) {
+        TaskPool::deallocate(block, 32);
+    }
+}
+
+/**
+ * @brief Tests that scheduler add/remove churn does not reach the global heap once warm.
+ *
+ * @details The first round of churn is queued before `\`start()\``, so it fills the pool
+ * with at least as many blocks as any later backlog of control calls can hold, and
+ * sizes the run queue and the task table's buckets. The second, identical round must
+ * not call `\`operator new\`` on either the calling thread or the worker.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_SchedulerChurnWithoutHeap) {
+    PeriodicScheduler scheduler;
+    std::atomic<int> ticks{0};
+    const auto churn = [&scheduler]() {
+        for (int i = 0; i < 20000; ++i) {
+            scheduler.remove_task(scheduler.add_task(1h, []() {}));
+            scheduler.cancel(scheduler.schedule_after(1h, []() {}));
+        }
+    };
+    const auto sync = [&scheduler, &ticks]() {
+        ticks = 0;
+        scheduler.post_at(PeriodicScheduler::clock_type::now(), [&ticks]() { ++ticks; });
+        while (ticks.load() == 0) {
+            std::this_thread::sleep_for(1ms);
+        }
+    };
+    churn();
+    scheduler.start();
+    sync();
+    sync(); // the dispatch loop swaps two scratch buffers; grow both
+
+    heap_mode.store(HeapMode::Counted);
+    churn();
+    sync();
+    heap_mode.store(HeapMode::Allowed);
+    scheduler.stop();
+
+    BOOST_CHECK_EQUAL(heap_allocations.exchange(0), 0);
+}
+
+/**
+ * @brief Tests that dispatching with a deferral window does not reach the global heap.
+ *
+ * @details Two tasks on 5ms and 7ms grids keep entries inside the 20ms look-ahead at
+ * every wakeup, so each dispatch inspects imminent entries. After a warm-up the
+ * worker must dispatch without calling `\`operator new\``.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_DeferralWithoutHeap) {
+    PeriodicScheduler scheduler;
+    std::atomic<int> ticks{0};
+    scheduler.set_deferral_window(20ms);
+    scheduler.add_task(5ms, [&ticks]() { ++ticks; }, 0);
+    scheduler.add_task(7ms, [&ticks]() { ++ticks; }, 1);
+    scheduler.start();
+    std::this_thread::sleep_for(50ms);
+
+    heap_mode.store(HeapMode::Counted);
+    const int before = ticks.load();
+    std::this_thread::sleep_for(100ms);
+    const int during = ticks.load() - before;
+    heap_mode.store(HeapMode::Allowed);
+    scheduler.stop();
+
+    BOOST_CHECK_GE(during, 20);
+    BOOST_CHECK_EQUAL(heap_allocations.exchange(0), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TaskPoolTests
+
+/** @} */
@@ -0,0 +1,166 @@
+#define BOOST_TEST_MODULE TickBroadcastTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "TickBroadcast.hpp" // Include the component under test
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <sys/wait.h>
+
+using namespace std::chrono_literals;
+
+/**
+ * @brief Provides a fresh broadcast file path and removes the file afterwards.
+ */
+struct BroadcastFileFixture {
+    BroadcastFileFixture()
+        : path((std::filesystem::temp_directory_path() / ("tick_broadcast_" + std::to_string(::getpid()))).string()) {}
+    ~BroadcastFileFixture() {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+    }
+
+    std::string path;
+};
+
+/**
+ * @defgroup TickBroadcastTestSuite TickBroadcast Unit Tests
+ * @brief Test cases for verifying the shared tick source across threads and processes.
+ * @{
+ */
+
+BOOST_FIXTURE_TEST_SUITE(TickBroadcastTests, BroadcastFileFixture)
+
+/**
+ * @brief Tests that two followers see every tick of one broadcaster.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_FollowersShareTicks) {
+    TickBroadcaster broadcaster(path);
+    TickFollower spinning(path);
+    TickFollower blocking(path);
+    std::atomic<int> spun{0};
+    std::atomic<int> blocked{0};
+    spinning.start([&spun](std::uint64_t) { ++spun; }, 200us);
+    blocking.start([&blocked](std::uint64_t) { ++blocked; });
+
+    broadcaster.start(5ms);
+    std::this_thread::sleep_for(200ms);
+    broadcaster.stop();
+    spinning.stop();
+    blocking.stop();
+
+    const auto ticks = static_cast<int>(broadcaster.ticks());
+    BOOST_CHECK_GE(ticks, 30);
+    BOOST_CHECK_GE(spun.load(), ticks - 2);
+    BOOST_CHECK_GE(blocked.load(), ticks - 2);
+    BOOST_CHECK_LE(blocked.load(), ticks);
+}
+
+/**
+ * @brief Tests that `wait()` times out without ticks and returns at once after `stop()`.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_TimeoutAndClose) {
+    TickBroadcaster broadcaster(path);
+    TickFollower follower(path);
+    std::uint64_t seen = 0;
+    BOOST_CHECK(!follower.wait(seen, 20ms));
+
+    broadcaster.start(5ms);
+    BOOST_CHECK(follower.wait(seen, 100ms));
+    BOOST_CHECK_GE(seen, 1u);
+
+    std::thread closer([&broadcaster]() {
+        std::this_thread::sleep_for(20ms);
+        broadcaster.stop();
+    });
+    const auto start = std::chrono::steady_clock::now();
+    while (follower.wait(seen, 2s)) {
+    }
+    BOOST_CHECK(std::chrono::steady_clock::now() - start < 1s);
+    BOOST_CHECK(follower.closed());
+    closer.join();
+}
+
+/**
+ * @brief Tests a follower in a child process.
+ *
+ * @details The child waits for ten ticks through the futex and reports through its exit
+ * status whether they arrived in order and within the expected time.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_FollowerInOtherProcess) {
+    TickBroadcaster broadcaster(path);
+    broadcaster.start(2ms);
+    const pid_t child = ::fork();
+    BOOST_REQUIRE_GE(child, 0);
+    if (child == 0) {
+        int status = 0;
+        try {
+            TickFollower follower(path);
+            std::uint64_t seen = follower.sequence();
+            const std::uint64_t first = seen;
+            for (int i = 0; i < 10 && status == 0; ++i) {
+                const std::uint64_t before = seen;
+                if (!follower.wait(seen, 500ms) || seen <= before) {
+                    status = 1;
+                }
+            }
+            if (status == 0 && seen - first < 10) {
+                status = 2;
+            }
+        } catch (...) {
+            status = 3;
+        }
+        ::_exit(status);
+    }
+    int status = -1;
+    BOOST_REQUIRE_EQUAL(::waitpid(child, &status, 0), child);
+    BOOST_REQUIRE(WIFEXITED(status));
+    BOOST_CHECK_EQUAL(WEXITSTATUS(status), 0);
+    broadcaster.stop();
+}
+
+/**
+ * @brief Tests that a restarted broadcaster takes over the file of an attached follower.
+ *
+ * @details The follower keeps its mapping across the restart; the new broadcaster must
+ * neither truncate the file nor reset the sequence, so the follower's thread goes on
+ * receiving strictly increasing sequence numbers.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_BroadcasterRestart) {
+    std::uint64_t before_restart = 0;
+    std::atomic<std::uint64_t> last{0};
+    std::atomic<bool> ordered{true};
+    std::unique_ptr<TickFollower> follower;
+    {
+        TickBroadcaster broadcaster(path);
+        broadcaster.start(5ms);
+        follower = std::make_unique<TickFollower>(path);
+        follower->start([&last, &ordered](std::uint64_t sequence) {
+            if (sequence <= last.exchange(sequence)) {
+                ordered = false;
+            }
+        });
+        std::this_thread::sleep_for(50ms);
+        before_restart = broadcaster.ticks();
+    }
+
+    TickBroadcaster restarted(path);
+    BOOST_CHECK_EQUAL(restarted.ticks(), before_restart);
+    restarted.start(5ms);
+    std::this_thread::sleep_for(100ms);
+    restarted.stop();
+    follower->stop();
+
+    BOOST_CHECK_GE(before_restart, 5u);
+    BOOST_CHECK_GE(last.load(), before_restart + 10);
+    BOOST_CHECK(ordered.load());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TickBroadcastTests
+
+/** @} */
@@ -0,0 +1,146 @@
+#define BOOST_TEST_MODULE TimeSlicedTaskTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "TimeSlicedTask.hpp" // Include the component under test
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup TimeSlicedTaskTestSuite TimeSlicedTask Unit Tests
+ * @brief Test cases for verifying budgeted, resumable execution on fibers.
+ * @{
+ */
+
+namespace {
+
+/**
+ * @brief Busy-waits, so the work consumes budget like real computation.
+ */
+void spin_for(std::chrono::microseconds duration) {
+    const auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+/**
+ * @brief Processes items from a nested call, so checkpoints are not in the body itself.
+ */
+void process_items(TimeSlice& slice, std::atomic<int>& processed, int count) {
+    for (int i = 0; i < count; ++i) {
+        spin_for(200us);
+        processed++;
+        slice.checkpoint();
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(TimeSlicedTaskTests)
+
+/**
+ * @brief Tests that each slice stays within its budget and the work progresses incrementally.
+ *
+ * @details 100 items of 200us each with a 2ms budget need about ten slices. Every
+ * slice before the last must make progress, every slice must end shortly after the
+ * budget, and the body must complete exactly once.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_SlicesRespectBudget) {
+    std::atomic<int> processed{0};
+    TimeSlicedTask task(2ms, [&](TimeSlice& slice) { process_items(slice, processed, 100); });
+
+    int previous = 0;
+    while (task.completed_runs() == 0) {
+        const auto begin = std::chrono::steady_clock::now();
+        task.run_slice();
+        const auto took = std::chrono::steady_clock::now() - begin;
+        // One 200us item of overrun plus scheduling noise.
+        BOOST_CHECK_LT(std::chrono::duration_cast<std::chrono::microseconds>(took).count(), 2000 + 3000);
+        if (task.completed_runs() == 0) {
+            BOOST_CHECK_GT(processed.load(), previous);
+        }
+        previous = processed.load();
+        BOOST_REQUIRE_LT(task.slices(), 100u);
+    }
+    BOOST_CHECK_EQUAL(processed.load(), 100);
+    BOOST_CHECK_GE(task.slices(), 8u);
+    BOOST_CHECK_EQUAL(task.completed_runs(), 1u);
+}
+
+/**
+ * @brief Tests that the internal tick completes the body repeatedly.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_PeriodicTickRestartsBody) {
+    std::atomic<int> processed{0};
+    TimeSlicedTask task(1ms, [&](TimeSlice& slice) { process_items(slice, processed, 10); });
+
+    task.start(5ms);
+    std::this_thread::sleep_for(200ms);
+    task.stop();
+
+    BOOST_CHECK_GE(task.completed_runs(), 3u);
+    BOOST_CHECK_GT(task.slices(), task.completed_runs());
+}
+
+/**
+ * @brief Tests that body exceptions reach the caller and a suspended body is unwound.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_ExceptionsAndUnwinding) {
+    TimeSlicedTask failing(1ms, [](TimeSlice& slice) {
+        slice.yield();
+        throw std::runtime_error("sweep failed");
+    });
+    failing.run_slice();
+    BOOST_CHECK_THROW(failing.run_slice(), std::runtime_error);
+    BOOST_CHECK_EQUAL(failing.completed_runs(), 0u);
+
+    struct Guard {
+        std::atomic<bool>& destroyed;
+        ~Guard() { destroyed = true; }
+    };
+    std::atomic<bool> destroyed{false};
+    {
+        TimeSlicedTask suspended(1ms, [&](TimeSlice& slice) {
+            Guard guard{destroyed};
+            for (;;) {
+                slice.yield();
+            }
+        });
+        suspended.run_slice();
+        BOOST_CHECK(!destroyed);
+    }
+    BOOST_CHECK(destroyed);
+}
+
+/**
+ * @brief Tests that a throwing body does not end the internal tick.
+ *
+ * @details Every second run of the body throws. Under `\`start()\`` the exception must
+ * show up in `\`last_error()\`` while later runs still complete.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_ErrorsUnderStartKeepTicking) {
+    std::atomic<int> runs{0};
+    TimeSlicedTask task(1ms, [&runs](TimeSlice&) {
+        if (++runs % 2 == 0) {
+            throw std::runtime_error("sweep failed");
+        }
+    });
+    BOOST_CHECK(!task.last_error());
+
+    task.start(5ms);
+    std::this_thread::sleep_for(60ms);
+    task.stop();
+
+    BOOST_CHECK_GE(runs.load(), 6);
+    BOOST_CHECK_GE(task.completed_runs(), 3u);
+    BOOST_REQUIRE(task.last_error());
+    BOOST_CHECK_THROW(std::rethrow_exception(task.last_error()), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TimeSlicedTaskTests
+
+/** @} */
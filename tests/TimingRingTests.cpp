@@ -0,0 +1,138 @@
+#define BOOST_TEST_MODULE TimingRingTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "PeriodicExecutor.hpp" // Include the component under test
+#include "TimingRing.hpp"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup TimingRingTestSuite TimingRing Unit Tests
+ * @brief Test cases for verifying the timing ring layout, wrap-around and the executor hook.
+ * @{
+ */
+
+BOOST_AUTO_TEST_SUITE(TimingRingTests)
+
+/**
+ * @brief Tests reading across wrap-around, including the count of overwritten records.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_WrapAroundAndLoss) {
+    std::vector<std::uint64_t> memory(TimingRing::bytes_for(6) / sizeof(std::uint64_t));
+    TimingRing ring = TimingRing::create(memory.data(), 6);
+    BOOST_CHECK_EQUAL(ring.capacity(), 8u);
+
+    for (int i = 0; i < 5; ++i) {
+        ring.record(TimingRecord{i, i, i, 0, 0});
+    }
+    std::uint64_t next = 0;
+    std::vector<TimingRecord> out;
+    BOOST_CHECK_EQUAL(ring.read(next, out), 0u);
+    BOOST_CHECK_EQUAL(out.size(), 5u);
+    BOOST_CHECK_EQUAL(next, 5u);
+
+    for (int i = 5; i < 25; ++i) {
+        ring.record(TimingRecord{i, i, i, 0, 0});
+    }
+    out.clear();
+    BOOST_CHECK_EQUAL(ring.read(next, out), 12u);
+    BOOST_REQUIRE_EQUAL(out.size(), 8u);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        BOOST_CHECK_EQUAL(out[i].deadline_ns, static_cast<std::int64_t>(17 + i));
+    }
+    BOOST_CHECK_EQUAL(next, ring.written());
+}
+
+/**
+ * @brief Tests that attaching rejects blocks that do not hold a valid ring.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_AttachValidatesHeader) {
+    std::vector<std::uint64_t> memory(TimingRing::bytes_for(4) / sizeof(std::uint64_t));
+    BOOST_CHECK_THROW(TimingRing::attach(memory.data(), memory.size() * sizeof(std::uint64_t)), std::runtime_error);
+    TimingRing::create(memory.data(), 4);
+    BOOST_CHECK_NO_THROW(TimingRing::attach(memory.data(), memory.size() * sizeof(std::uint64_t)));
+    BOOST_CHECK_THROW(TimingRing::attach(memory.data(), 100), std::runtime_error);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * @brief Tests an executor writing into a ring file that a second mapping reads live.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_ExecutorWritesRingFile) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                       ("timing_ring_" + std::to_string(::getpid()) + ".bin");
+    {
+        TimingRingFile writer(path.string(), 64);
+        TimingRingFile reader(path.string());
+        PeriodicExecutor<> executor;
+        executor.set_timing_ring(&writer.ring());
+        executor.start(5ms, []() { std::this_thread::sleep_for(1ms); });
+        std::this_thread::sleep_for(100ms);
+        executor.stop();
+
+        std::uint64_t next = 0;
+        std::vector<TimingRecord> records;
+        BOOST_CHECK_EQUAL(reader.ring().read(next, records), 0u);
+        BOOST_CHECK_EQUAL(records.size(), executor.stats().tick_count);
+        BOOST_CHECK_GE(records.size(), 10u);
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            BOOST_CHECK_GE(records[i].wake_ns, records[i].deadline_ns);
+            BOOST_CHECK_GE(records[i].duration_ns, 1000000);
+            if (i > 0) {
+                BOOST_CHECK_EQUAL(records[i].deadline_ns - records[i - 1].deadline_ns, 5000000);
+            }
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+/**
+ * @brief Tests that a restarted writer neither truncates nor resets a ring that readers map.
+ *
+ * @details The reader stays mapped across two writers. The second writer of the same
+ * capacity must continue after the first one's records, so the reader's cursor stays
+ * valid; a writer of a smaller capacity must re-initialize without shrinking the file.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_WriterRestartKeepsReaders) {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                       ("timing_ring_restart_" + std::to_string(::getpid()) + ".bin");
+    const auto size = TimingRing::bytes_for(64);
+    {
+        std::uint64_t next = 0;
+        std::vector<TimingRecord> records;
+        std::unique_ptr<TimingRingFile> writer = std::make_unique<TimingRingFile>(path.string(), 64);
+        TimingRingFile reader(path.string());
+        writer->ring().record(TimingRecord{1, 1, 1, 1});
+        writer->ring().record(TimingRecord{2, 2, 2, 2});
+        BOOST_CHECK_EQUAL(reader.ring().read(next, records), 0u);
+        BOOST_CHECK_EQUAL(next, 2u);
+
+        writer = std::make_unique<TimingRingFile>(path.string(), 64);
+        BOOST_CHECK_EQUAL(writer->ring().written(), 2u);
+        writer->ring().record(TimingRecord{3, 3, 3, 3});
+        BOOST_CHECK_EQUAL(reader.ring().read(next, records), 0u);
+        BOOST_REQUIRE_EQUAL(records.size(), 3u);
+        BOOST_CHECK_EQUAL(records[2].deadline_ns, 3);
+
+        writer = std::make_unique<TimingRingFile>(path.string(), 16);
+        BOOST_CHECK_EQUAL(writer->ring().capacity(), 16u);
+        BOOST_CHECK_EQUAL(writer->ring().written(), 0u);
+        BOOST_CHECK_EQUAL(std::filesystem::file_size(path), size);
+        BOOST_CHECK_EQUAL(reader.ring().written(), 0u); // the reader's mapping is still backed
+    }
+    std::filesystem::remove(path);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // TimingRingTests
+
+/** @} */
@@ -0,0 +1,87 @@
+#define BOOST_TEST_MODULE TokenBucketLimiterTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "TokenBucketLimiter.hpp" // Include the component under test
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup LimiterTestSuite TokenBucketLimiter Unit Tests
+ * @brief Test cases for burst limits, tick-driven refill and concurrent acquisition.
+ * @{
+ */
+
+BOOST_AUTO_TEST_SUITE(TokenBucketLimiterTests)
+
+/**
+ * @brief Tests that a full bucket admits exactly its capacity.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_BurstUpToCapacity) {
+    TokenBucketLimiter limiter(4, 5, 1);
+    for (int i = 0; i < 5; ++i) {
+        BOOST_CHECK(limiter.try_acquire(0));
+    }
+    BOOST_CHECK(!limiter.try_acquire(0));
+    BOOST_CHECK_EQUAL(limiter.available(0), 0u);
+    // Other buckets are independent.
+    BOOST_CHECK(limiter.try_acquire(1, 5));
+    BOOST_CHECK(!limiter.try_acquire(2, 6));
+}
+
+/**
+ * @brief Tests lazy refill from the shared tick, capped at the capacity.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_RefillFromTick) {
+    TokenBucketLimiter limiter(1, 10, 2);
+    BOOST_CHECK(limiter.try_acquire(0, 10));
+    limiter.start(20ms);
+
+    std::this_thread::sleep_for(70ms);
+    const auto ticks = limiter.ticks();
+    const auto tokens = limiter.available(0);
+    BOOST_CHECK_GE(ticks, 2u);
+    BOOST_CHECK(tokens == 10u || tokens >= 2 * ticks);
+
+    std::this_thread::sleep_for(150ms);
+    limiter.stop();
+    BOOST_CHECK_EQUAL(limiter.available(0), 10u);
+}
+
+/**
+ * @brief Tests that concurrent callers never take more tokens than were issued.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_ConcurrentAcquire) {
+    TokenBucketLimiter limiter(1, 100, 10);
+    std::atomic<long> granted{0};
+    std::atomic<bool> running{true};
+    limiter.start(5ms);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&]() {
+            while (running) {
+                if (limiter.try_acquire(0)) {
+                    granted++;
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(200ms);
+    running = false;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    limiter.stop();
+
+    BOOST_CHECK_GT(granted.load(), 100);
+    BOOST_CHECK_LE(granted.load(), static_cast<long>(100 + 10 * limiter.ticks()));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TokenBucketLimiterTests
+
+/** @} */
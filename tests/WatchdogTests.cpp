@@ -0,0 +1,176 @@
+#define BOOST_TEST_MODULE WatchdogTestModule
+// Use the header-only version of Boost Test for simpler compilation
+#include <boost/test/included/unit_test.hpp>
+
+#include "PeriodicExecutor.hpp" // Include the component under test
+#include "Watchdog.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+/**
+ * @defgroup WatchdogTestSuite Watchdog Unit Tests
+ * @brief Test cases for verifying stall detection by the Watchdog.
+ * @{
+ */
+
+/**
+ * @brief Collects the reports delivered to the watchdog hook.
+ */
+struct ReportFixture {
+    std::vector<StallReport> reports;
+    std::mutex reports_mutex;
+
+    Watchdog::Hook hook() {
+        return [this](const StallReport& report) {
+            std::lock_guard<std::mutex> lock(reports_mutex);
+            reports.push_back(report);
+        };
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(WatchdogTests, ReportFixture)
+
+/**
+ * @brief Tests that a blocked callback is reported once with its name and duration.
+ *
+ * @details The first execution blocks for 300ms against a budget of 3 x 20ms; one
+ * watchdog serves both executors, and only the blocked one may be reported.
+ */
+BOOST_AUTO_TEST_CASE(Test_01_ReportsStuckCallback) {
+    Watchdog watchdog(hook(), 20ms);
+    watchdog.start();
+
+    PeriodicExecutor<> stuck;
+    PeriodicExecutor<> healthy;
+    stuck.set_watchdog(watchdog, 3, "stuck");
+    healthy.set_watchdog(watchdog, 3, "healthy");
+    std::atomic<int> calls{0};
+    stuck.start(20ms, [&]() {
+        if (calls++ == 0) {
+            std::this_thread::sleep_for(300ms);
+        }
+    });
+    healthy.start(20ms, []() {});
+
+    std::this_thread::sleep_for(400ms);
+    stuck.stop();
+    healthy.stop();
+    watchdog.stop();
+
+    std::lock_guard<std::mutex> lock(reports_mutex);
+    BOOST_REQUIRE_EQUAL(reports.size(), 1u);
+    BOOST_CHECK_EQUAL(reports[0].name, "stuck");
+    BOOST_CHECK_EQUAL(reports[0].budget.count(), 60);
+    BOOST_CHECK_GE(reports[0].running_for.count(), 60);
+    BOOST_CHECK_LT(reports[0].running_for.count(), 150);
+}
+
+#if defined(__linux__)
+/**
+ * @brief Tests that stack capture returns the stalled worker's frames.
+ */
+BOOST_AUTO_TEST_CASE(Test_02_CapturesWorkerStack) {
+    Watchdog watchdog(hook(), 20ms);
+    BOOST_REQUIRE(watchdog.enable_stack_capture());
+    watchdog.start();
+
+    PeriodicExecutor<> stuck;
+    stuck.set_watchdog(watchdog, 2, "stuck");
+    std::atomic<bool> release{false};
+    stuck.start(10ms, [&]() {
+        while (!release) {
+            std::this_thread::sleep_for(1ms);
+        }
+    });
+
+    std::this_thread::sleep_for(150ms);
+    release = true;
+    stuck.stop();
+    watchdog.stop();
+
+    std::lock_guard<std::mutex> lock(reports_mutex);
+    BOOST_REQUIRE_EQUAL(reports.size(), 1u);
+    BOOST_CHECK_GT(reports[0].stack.size(), 2u);
+}
+
+/**
+ * @brief Tests that stack capture signals the current worker after a restart.
+ *
+ * @details The first run executes normally and its worker is joined by `\`stop()\``;
+ * the stall of the second run must be captured from the second worker.
+ */
+BOOST_AUTO_TEST_CASE(Test_03_CapturesStackAfterRestart) {
+    Watchdog watchdog(hook(), 20ms);
+    BOOST_REQUIRE(watchdog.enable_stack_capture());
+    watchdog.start();
+
+    PeriodicExecutor<> stuck;
+    stuck.set_watchdog(watchdog, 2, "stuck");
+    stuck.start(10ms, []() {});
+    std::this_thread::sleep_for(35ms);
+    stuck.stop();
+
+    std::atomic<bool> release{false};
+    stuck.start(10ms, [&]() {
+        while (!release) {
+            std::this_thread::sleep_for(1ms);
+        }
+    });
+    std::this_thread::sleep_for(150ms);
+    release = true;
+    stuck.stop();
+    watchdog.stop();
+
+    std::lock_guard<std::mutex> lock(reports_mutex);
+    BOOST_REQUIRE_EQUAL(reports.size(), 1u);
+    BOOST_CHECK_GT(reports[0].stack.size(), 2u);
+}
+#endif
+
+/**
+ * @brief Tests that only one watchdog at a time owns the process-wide stack capture.
+ */
+BOOST_AUTO_TEST_CASE(Test_04_SingleStackCaptureOwner) {
+    Watchdog second(hook(), 20ms);
+    {
+        Watchdog first(hook(), 20ms);
+        BOOST_REQUIRE(first.enable_stack_capture());
+        BOOST_CHECK(first.enable_stack_capture());
+        BOOST_CHECK(!second.enable_stack_capture());
+    }
+    BOOST_CHECK(second.enable_stack_capture());
+}
+
+/**
+ * @brief Tests that executions ending while a stall is captured do not race the capture.
+ *
+ * @details Short callbacks exceed a zero-length budget on every scan, so the monitor
+ * keeps signalling workers that are about to end their execution; the executor is
+ * restarted repeatedly so each worker is joined right after its last `\`end()\``.
+ */
+BOOST_AUTO_TEST_CASE(Test_05_CaptureRacesExecutionEnd) {
+    Watchdog watchdog(hook(), 1ms);
+    BOOST_REQUIRE(watchdog.enable_stack_capture());
+    watchdog.start();
+
+    PeriodicExecutor<> executor;
+    executor.set_watchdog(watchdog, 0, "short");
+    for (int i = 0; i < 20; ++i) {
+        executor.start(1ms, []() { std::this_thread::sleep_for(std::chrono::microseconds(500)); });
+        std::this_thread::sleep_for(5ms);
+        executor.stop();
+    }
+    watchdog.stop();
+
+    std::lock_guard<std::mutex> lock(reports_mutex);
+    BOOST_CHECK_GT(reports.size(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // WatchdogTests
+
+/** @} */